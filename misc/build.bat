@@ -35,6 +35,11 @@ REM		echo Metaprogram failed.
 REM
 REM		:end
 REM		:
+REM
+REM		cl /nologo /DDATA_DIR="\"W:/data/\"" /DEXE_DIR="\"W:/build/\"" /DSRC_DIR="\"W:/src/\"" /std:c++17 /O2 /DDEBUG=0 /Z7 /MT /GR- /EHsc /EHa- %WARNINGS% /permissive- /Febenchmark.exe W:\src\benchmark.cpp /link /opt:ref /incremental:no
+REM
+REM		cl /nologo /DDATA_DIR="\"W:/data/\"" /DEXE_DIR="\"W:/build/\"" /DSRC_DIR="\"W:/src/\"" /std:c++17 /O2 /DDEBUG=0 /Z7 /MT /GR- /EHsc /EHa- %WARNINGS% /permissive- /c /FoMeat_library.obj W:\src\Meat_library.cpp
+REM		lib /nologo /OUT:Meat_library.lib Meat_library.obj
 
 		cl /nologo /DDATA_DIR="\"W:/data/\"" /DEXE_DIR="\"W:/build/\"" /DSRC_DIR="\"W:/src/\"" /std:c++17 /Od /DDEBUG=1 /Z7 /MTd /GR- /EHsc /EHa- %DEBUG_WARNINGS% /permissive- /FeMeat.exe W:\src\Meat_DirectX11.cpp /link %LIBRARIES% /subsystem:WINDOWS /DEBUG:FULL /opt:ref /incremental:no
 	)
@@ -1,7 +1,29 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <immintrin.h>
 #include "unified.h"
+#include "Meat_columns.h"
+
+// @NOTE@ `MEAT_PRECISION` is chosen per build: 32 computes in `f32` throughout, 64 in `f64` throughout, and 0 is mixed, where numbers
+// are `f64` for accuracy but the elements of arrays stay `f32` so that batch work keeps its SIMD width. Everything that depends on it is
+// settled when compiling, so each build gets its own fast paths and nothing checks the precision at run time.
+#ifndef MEAT_PRECISION
+#define MEAT_PRECISION 32
+#endif
+
+#if MEAT_PRECISION == 32
+typedef f32 Number;
+typedef f32 Element;
+#elif MEAT_PRECISION == 64
+typedef f64 Number;
+typedef f64 Element;
+#elif MEAT_PRECISION == 0
+typedef f64 Number;
+typedef f32 Element;
+#else
+#error "`MEAT_PRECISION` must be 32, 64 or 0."
+#endif
 
 enum struct TokenKind : u8
 {
@@ -16,6 +38,7 @@ enum struct TokenKind : u8
 	parenthesis_end,
 
 	parenthetical_application,
+	inlined_application,
 	equal,
 	comma,
 	plus,
@@ -23,7 +46,11 @@ enum struct TokenKind : u8
 	asterisk,
 	forward_slash,
 	caret,
-	exclamation_point
+	exclamation_point,
+	bracket_start,
+	bracket_end,
+	colon,
+	array
 };
 
 struct Token
@@ -57,32 +84,338 @@ struct SyntaxTree
 	};
 	SyntaxTree* right;
 	Token       token;
+	Number      number;          // @NOTE@ Parsed value of number literals.
+	i32         reference_count; // @NOTE@ Greater than one when hash-consing made the node shared.
+	i32         memo_index;      // @NOTE@ Nonzero for shared nodes whose value does not depend on function arguments.
+};
+
+enum struct ValueType : u8
+{
+	number,
+	array,
+	dual,
+	integer
+};
+
+// @NOTE@ A value is one NaN-boxed 8-byte word. Anything that is not a number is boxed in the negative quiet NaNs of an `f64`: bits 48 to 50
+// hold its nonzero `ValueType` and the low 48 bits its payload, which for an array is a pointer to its `ValueArray`. A number is the bits
+// of the `Number` it is computed in. An `f32` sits in the low half of the word with the high half zero, which is never a box. An `f64` is
+// its own bits, with every NaN folded into the default one so that none is taken for a box. Either way reading or writing a number is one
+// move with no tag to check or strip. All zero bits are the number zero.
+struct Value
+{
+	u64 bits;
+};
+
+// @NOTE@ Lives in the value arena of the allocator that made it, along with its elements.
+struct ValueArray
+{
+	i32      count;
+	Element* elements;
+};
+
+global constexpr u64 VALUE_BOX_BITS     = 0xFFF8000000000000;
+global constexpr u64 VALUE_TYPE_MASK    = 0x0007000000000000;
+global constexpr u64 VALUE_PAYLOAD_MASK = 0x0000FFFFFFFFFFFF;
+
+// @NOTE@ Boxes are the only words whose top sixteen bits exceed those of `VALUE_BOX_BITS`, so this is one mask and one comparison.
+internal bool32 is_number_value(Value value)
+{
+	return (value.bits & ~VALUE_PAYLOAD_MASK) <= VALUE_BOX_BITS;
+}
+
+internal ValueType get_value_type(Value value)
+{
+	return is_number_value(value) ? ValueType::number : static_cast<ValueType>((value.bits & VALUE_TYPE_MASK) >> 48);
+}
+
+internal Value box_number(Number number)
+{
+	if constexpr (sizeof(Number) == sizeof(u32))
+	{
+		u32 bits;
+		memcpy(&bits, &number, sizeof(bits));
+		return { bits };
+	}
+	else
+	{
+		if (number != number)
+		{
+			return { VALUE_BOX_BITS };
+		}
+
+		Value value;
+		memcpy(&value.bits, &number, sizeof(value.bits));
+		return value;
+	}
+}
+
+// @NOTE@ Only for values known to be numbers.
+internal Number unbox_number(Value value)
+{
+	Number number;
+	if constexpr (sizeof(Number) == sizeof(u32))
+	{
+		u32 bits = static_cast<u32>(value.bits);
+		memcpy(&number, &bits, sizeof(number));
+	}
+	else
+	{
+		memcpy(&number, &value.bits, sizeof(number));
+	}
+	return number;
+}
+
+// @NOTE@ An exact integer, which integer literals evaluate to under `-exact`. Integers of magnitude under `INTEGER_SMALL_LIMIT` are kept
+// in the payload itself, flagged by its top bit, so that the literals of a ledger don't allocate; larger ones are boxed like arrays.
+// Lives in the value arena of the allocator that made it, along with its limbs, which have no leading zeros, so zero has none.
+struct ValueInteger
+{
+	i32    limb_count;
+	bool32 is_negative;
+	u32*   limbs;
+};
+
+global constexpr u64 VALUE_SMALL_INTEGER_BIT = 0x0000800000000000;
+global constexpr i64 INTEGER_SMALL_LIMIT     = 1LL << 46;
+
+internal bool32 is_small_integer_value(Value value)
+{
+	return get_value_type(value) == ValueType::integer && (value.bits & VALUE_SMALL_INTEGER_BIT);
+}
+
+internal Value box_small_integer(i64 integer)
+{
+	ASSERT(-INTEGER_SMALL_LIMIT < integer && integer < INTEGER_SMALL_LIMIT);
+	return { VALUE_BOX_BITS | (static_cast<u64>(ValueType::integer) << 48) | VALUE_SMALL_INTEGER_BIT | (static_cast<u64>(integer) & (VALUE_SMALL_INTEGER_BIT - 1)) };
+}
+
+// @NOTE@ Only for small integers.
+internal i64 unbox_small_integer(Value value)
+{
+	return static_cast<i64>(value.bits << 17) >> 17;
+}
+
+// @NOTE@ Trims the leading zero limbs first, and keeps the integer in the payload if it turns out to be small.
+internal Value box_integer(ValueInteger* integer)
+{
+	integer->limb_count  = trim_limbs(integer->limbs, integer->limb_count);
+	integer->is_negative = integer->is_negative && integer->limb_count;
+
+	if (integer->limb_count <= 2)
+	{
+		u64 magnitude = 0;
+		memcpy(&magnitude, integer->limbs, sizeof(u32) * integer->limb_count);
+		if (magnitude < static_cast<u64>(INTEGER_SMALL_LIMIT))
+		{
+			return box_small_integer(integer->is_negative ? -static_cast<i64>(magnitude) : static_cast<i64>(magnitude));
+		}
+	}
+
+	ASSERT(!(reinterpret_cast<u64>(integer) & ~VALUE_PAYLOAD_MASK & ~VALUE_SMALL_INTEGER_BIT)); // @NOTE@ Pointers leave the flag clear.
+	return { VALUE_BOX_BITS | (static_cast<u64>(ValueType::integer) << 48) | reinterpret_cast<u64>(integer) };
+}
+
+// @NOTE@ Small integers have no limbs of their own, so theirs are written to `limb_buffer`, which holds two.
+internal ValueInteger get_value_integer(Value value, u32* limb_buffer)
+{
+	ASSERT(get_value_type(value) == ValueType::integer);
+
+	if (!is_small_integer_value(value))
+	{
+		return *reinterpret_cast<ValueInteger*>(value.bits & VALUE_PAYLOAD_MASK);
+	}
+
+	i64 integer   = unbox_small_integer(value);
+	u64 magnitude = static_cast<u64>(integer < 0 ? -integer : integer);
+	limb_buffer[0] = static_cast<u32>(magnitude);
+	limb_buffer[1] = static_cast<u32>(magnitude >> 32);
+	return { trim_limbs(limb_buffer, 2), integer < 0, limb_buffer };
+}
+
+// @NOTE@ The integer is `*scaled * 2^*exponent`, where `*scaled` is rounded once from the top 64 bits of the magnitude, with any bit below
+// them folded into the lowest so that the rounding is still to the nearest. Scaling keeps the ratio of two huge integers finite.
+internal f64 get_integer_scaled(ValueInteger integer, i32* exponent)
+{
+	*exponent = 0;
+	if (integer.limb_count <= 2)
+	{
+		u64 magnitude = 0;
+		memcpy(&magnitude, integer.limbs, sizeof(u32) * integer.limb_count);
+		return integer.is_negative ? -static_cast<f64>(magnitude) : static_cast<f64>(magnitude);
+	}
+
+	i32 top    = integer.limb_count - 1;
+	i32 shift  = count_leading_zeros(integer.limbs[top]);
+	u64 window = (static_cast<u64>(integer.limbs[top]) << 32) | integer.limbs[top - 1];
+	u32 rest   = integer.limbs[top - 2];
+	if (shift)
+	{
+		window = (window << shift) | (rest >> (32 - shift));
+		rest <<= shift;
+	}
+
+	bool32 is_inexact = rest != 0;
+	FOR_RANGE(i, top - 2)
+	{
+		is_inexact |= integer.limbs[i] != 0;
+	}
+
+	*exponent = 32 * (top + 1) - shift - 64;
+	f64 scaled = static_cast<f64>(window | (is_inexact ? 1 : 0));
+	return integer.is_negative ? -scaled : scaled;
+}
+
+internal f64 get_integer_f64(ValueInteger integer)
+{
+	i32 exponent;
+	f64 scaled = get_integer_scaled(integer, &exponent);
+	return ldexp(scaled, exponent);
+}
+
+// @NOTE@ For the places that only deal in numbers, such as assertions, sweeps and the library. Integers read as the nearest number, which
+// is infinite past the range of `Number`, and anything else as NaN.
+internal Number get_value_number(Value value)
+{
+	if (is_number_value(value))
+	{
+		return unbox_number(value);
+	}
+	else if (get_value_type(value) == ValueType::integer)
+	{
+		u32 limb_buffer[2];
+		return static_cast<Number>(get_integer_f64(get_value_integer(value, limb_buffer)));
+	}
+	else
+	{
+		return NAN;
+	}
+}
+
+// @NOTE@ Whether the value is one that `get_value_number` reads as itself.
+internal bool32 is_scalar_value(Value value)
+{
+	return is_number_value(value) || get_value_type(value) == ValueType::integer;
+}
+
+internal Value box_array(ValueArray* array)
+{
+	ASSERT(!(reinterpret_cast<u64>(array) & ~VALUE_PAYLOAD_MASK));
+	return { VALUE_BOX_BITS | (static_cast<u64>(ValueType::array) << 48) | reinterpret_cast<u64>(array) };
+}
+
+internal ValueArray* unbox_array(Value value)
+{
+	ASSERT(get_value_type(value) == ValueType::array);
+	return reinterpret_cast<ValueArray*>(value.bits & VALUE_PAYLOAD_MASK);
+}
+
+// @NOTE@ A dual number carries a derivative along with its value, so evaluating a function with its parameter bound to `{ x, 1 }` gives
+// the value and the slope at `x` in one pass. Dual numbers only arise while a functional differentiates, and are boxed like arrays.
+struct Dual
+{
+	Number value;
+	Number derivative;
 };
 
+internal Value box_dual(Dual* dual)
+{
+	ASSERT(!(reinterpret_cast<u64>(dual) & ~VALUE_PAYLOAD_MASK));
+	return { VALUE_BOX_BITS | (static_cast<u64>(ValueType::dual) << 48) | reinterpret_cast<u64>(dual) };
+}
+
+internal Dual* unbox_dual(Value value)
+{
+	ASSERT(get_value_type(value) == ValueType::dual);
+	return reinterpret_cast<Dual*>(value.bits & VALUE_PAYLOAD_MASK);
+}
+
+// @NOTE@ Numbers and integers are read as constants.
+internal Dual get_value_dual(Value value)
+{
+	if (is_scalar_value(value))
+	{
+		return { get_value_number(value), 0 };
+	}
+
+	ASSERT(get_value_type(value) == ValueType::dual); // Arrays can't be differentiated.
+	return *unbox_dual(value);
+}
+
+internal Dual operator+(Dual a, Dual b) { return { a.value + b.value, a.derivative + b.derivative }; }
+internal Dual operator-(Dual a, Dual b) { return { a.value - b.value, a.derivative - b.derivative }; }
+internal Dual operator*(Dual a, Dual b) { return { a.value * b.value, a.derivative * b.value + a.value * b.derivative }; }
+internal Dual operator/(Dual a, Dual b) { return { a.value / b.value, (a.derivative * b.value - a.value * b.derivative) / (b.value * b.value) }; }
+internal Dual operator-(Dual a)         { return { -a.value, -a.derivative }; }
+
+// @NOTE@ Built-ins are also instantiated for `Dual`, so whatever they call from the C runtime needs an overload here.
+
+internal Dual sin(Dual x)
+{
+	return { sin(x.value), cos(x.value) * x.derivative };
+}
+
+internal Dual cos(Dual x)
+{
+	return { cos(x.value), -sin(x.value) * x.derivative };
+}
+
+internal Dual tan(Dual x)
+{
+	Number value = tan(x.value);
+	return { value, (1 + value * value) * x.derivative };
+}
+
+internal Dual atan2(Dual y, Dual x)
+{
+	return { atan2(y.value, x.value), (x.value * y.derivative - y.value * x.derivative) / (x.value * x.value + y.value * y.value) };
+}
+
 struct FunctionArgumentNode
 {
 	FunctionArgumentNode* next_node;
 	StringView            name;
-	f32                   value;
+	Value                 value;
 };
 
-struct Allocator
+struct ParserFrame
 {
-	MemoryArena           arena;
-	i32                   allocated_token_buffer_node_count;
-	i32                   allocated_syntax_tree_count;
-	i32                   allocated_function_argument_node_count;
-	TokenBufferNode*      available_token_buffer_node;
-	SyntaxTree*           available_syntax_tree;
-	FunctionArgumentNode* available_function_argument_node;
+	SyntaxTree* tree;
+	Token       token;
+	i32         min_precedence;
 };
 
-struct Value
+struct ParserFrameBufferNode
 {
-	f32 number;
+	ParserFrameBufferNode* next_node;
+	i32                    count;
+	ParserFrame            buffer[64];
+};
+
+struct Allocator
+{
+	MemoryArena            arena;
+	MemoryArena            value_arena; // @NOTE@ Elements of arrays; only ever reset as a whole.
+	i32                    allocated_token_buffer_node_count;
+	i32                    allocated_syntax_tree_count;
+	i32                    allocated_function_argument_node_count;
+	i32                    allocated_parser_frame_buffer_node_count;
+	TokenBufferNode*       available_token_buffer_node;
+	SyntaxTree*            available_syntax_tree;
+	FunctionArgumentNode*  available_function_argument_node;
+	ParserFrameBufferNode* available_parser_frame_buffer_node;
+	const StringView*      evaluation_error; // @NOTE@ The first error met while evaluating; the value it came up in is NaN instead.
 };
 
 typedef Value Function(FunctionArgumentNode*);
+typedef void  ArrayFunction(Element* result, i32 count, Element** arguments);
+typedef Dual  DualFunction(Dual* arguments);
+
+// @NOTE@ Annotations on the built-ins of `predefined.cpp`. They expand to nothing and are only read by the metaprogram, which emits them
+// into the `PREDEFINED_FUNCTIONS` table along with the arity taken from each signature.
+#define PREDEFINED_PURE               // @NOTE@ Same arguments give the same value with no side effects, so calls may be folded or memoized.
+#define PREDEFINED_VECTORIZABLE       // @NOTE@ Applies element-wise, so it may be evaluated over many arguments at once.
+#define PREDEFINED_PIECEWISE_CONSTANT // @NOTE@ Flat wherever it has a slope, so a dual number only carries its value through it.
 
 enum struct VariableDeclarationStatus : u8
 {
@@ -115,40 +448,145 @@ struct Statement
 		struct
 		{
 			bool32 is_cached;
-			f32    cached_evaluation;
+			Value  cached_evaluation;
 		} expression;
 
 		struct
 		{
 			VariableDeclarationStatus status;
-			f32                       cached_evaluation;
+			Value                     cached_evaluation;
+			u64                       hash;
 		} variable_declaration;
 
 		struct
 		{
 			FunctionArgumentNode* args;
+			u64                   hash;
 		} function_declaration;
 	};
 };
 
+struct ValueCacheEntry;
+
+struct ValueCache
+{
+	i32              capacity;
+	ValueCacheEntry* entry_buffer; // @NOTE@ Open addressing; a hash of zero marks an empty slot.
+	i32              hit_count;
+	i32              miss_count;
+};
+
 struct Ledger
 {
-	i32       statement_count;
-	Statement statement_buffer[64];
+	i32         statement_count;
+	Statement   statement_buffer[64];
+	ValueCache* value_cache;
+	u32         memo_epoch;        // @NOTE@ Bumped to forget every memoized value at once.
+	i32         memo_count;
+	Value*      memo_value_buffer;
+	u32*        memo_epoch_buffer;
+	bool32      is_on_worker;      // @NOTE@ Set on the copies that workers evaluate, where reductions run serially instead of forking again.
+	bool32      is_exact;          // @NOTE@ Set by `-exact`, where integer literals evaluate to exact integers.
 };
 
-#include "predefined.cpp"
+internal bool32 is_integer_literal(SyntaxTree* tree, Ledger* ledger)
+{
+	return ledger->is_exact && !memchr(tree->token.string.data, '.', tree->token.string.size);
+}
+
 #include "meta/predefined.h"
+#include "meta/lexer.h"
+
+// @NOTE@ The predefined tables are laid out by a minimal perfect hash, so a lookup is one hash, one slot and one comparison.
+
+internal decltype(+PREDEFINED_CONSTANTS) find_predefined_constant(StringView name)
+{
+	i32 slot = get_perfect_hash_slot(PREDEFINED_CONSTANT_DISPLACEMENTS, ARRAY_CAPACITY(PREDEFINED_CONSTANT_DISPLACEMENTS), ARRAY_CAPACITY(PREDEFINED_CONSTANTS), hash_bytes(name));
+	return PREDEFINED_CONSTANTS[slot].name == name ? &PREDEFINED_CONSTANTS[slot] : 0;
+}
+
+internal decltype(+PREDEFINED_FUNCTIONS) find_predefined_function(StringView name)
+{
+	i32 slot = get_perfect_hash_slot(PREDEFINED_FUNCTION_DISPLACEMENTS, ARRAY_CAPACITY(PREDEFINED_FUNCTION_DISPLACEMENTS), ARRAY_CAPACITY(PREDEFINED_FUNCTIONS), hash_bytes(name));
+	return PREDEFINED_FUNCTIONS[slot].name == name ? &PREDEFINED_FUNCTIONS[slot] : 0;
+}
+
+// @NOTE@ Functionals take the name of a one-parameter function followed by numbers, so unlike the built-ins of `predefined.cpp` they are
+// evaluated by the interpreter itself; see `evaluate_functional`.
+enum struct FunctionalType : u8
+{
+	sum,
+	product,
+	integral,
+	derivative,
+	root,
+};
+
+global constexpr i32 FUNCTIONAL_MAX_ARITY = 3;
+
+global constexpr struct { StringView name; FunctionalType type; i32 arity; } FUNCTIONALS[] =
+	{
+		{ STRING_VIEW_OF("sum")       , FunctionalType::sum       , 3 },
+		{ STRING_VIEW_OF("prod")      , FunctionalType::product   , 3 },
+		{ STRING_VIEW_OF("integrate") , FunctionalType::integral  , 3 },
+		{ STRING_VIEW_OF("derivative"), FunctionalType::derivative, 2 },
+		{ STRING_VIEW_OF("solve")     , FunctionalType::root      , 2 },
+	};
+
+internal decltype(+FUNCTIONALS) find_functional(StringView name)
+{
+	FOR_ELEMS(it, FUNCTIONALS)
+	{
+		if (it->name == name)
+		{
+			return it;
+		}
+	}
+
+	return 0;
+}
+
+// @NOTE@ Returns -1 when the name is not of a built-in.
+internal i32 get_builtin_arity(StringView name)
+{
+	if (auto function = find_predefined_function(name))
+	{
+		return function->arity;
+	}
+	else if (auto functional = find_functional(name))
+	{
+		return functional->arity;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+// @TODO@ Make this more robust.
+internal Number parse_number(StringView string)
+{
+	char buffer[64];
+	sprintf_s(buffer, sizeof(buffer), "%.*s", PASS_STRING_VIEW(string));
+	Number result;
+	sscanf_s(buffer, sizeof(Number) == sizeof(f32) ? "%f" : "%lf", &result);
+	return result;
+}
 
 internal SyntaxTree* init_single_syntax_tree(Allocator* allocator, Token token, SyntaxTree* left, SyntaxTree* right)
 {
 	allocator->allocated_syntax_tree_count += 1;
 
 	SyntaxTree* allocation = memory_arena_allocate_from_available(&allocator->available_syntax_tree, &allocator->arena);
-	*allocation       = {};
-	allocation->token = token;
-	allocation->left  = left;
-	allocation->right = right;
+	*allocation                 = {};
+	allocation->token           = token;
+	allocation->left            = left;
+	allocation->right           = right;
+	allocation->reference_count = 1;
+	if (token.kind == TokenKind::number)
+	{
+		allocation->number = parse_number(token.string);
+	}
 	return allocation;
 }
 
@@ -156,6 +594,13 @@ internal void deinit_entire_syntax_tree(Allocator* allocator, SyntaxTree* tree)
 {
 	if (tree)
 	{
+		tree->reference_count -= 1;
+		ASSERT(tree->reference_count >= 0);
+		if (tree->reference_count)
+		{
+			return;
+		}
+
 		if (tree->left)
 		{
 			deinit_entire_syntax_tree(allocator, tree->left);
@@ -174,7 +619,7 @@ internal void deinit_entire_syntax_tree(Allocator* allocator, SyntaxTree* tree)
 	}
 }
 
-internal FunctionArgumentNode* init_function_argument_node(Allocator* allocator, StringView name, f32 value = 0.0f)
+internal FunctionArgumentNode* init_function_argument_node(Allocator* allocator, StringView name, Value value = {})
 {
 	allocator->allocated_function_argument_node_count += 1;
 
@@ -227,22 +672,11 @@ struct InitTokenizerStatus
 	StringView message;
 };
 
-internal bool32 init_tokenizer(InitTokenizerStatus* status, Tokenizer* tokenizer, Allocator* allocator, strlit file_path)
+// @NOTE@ Takes ownership of `file_data`, which must come from `malloc`; it is freed by `deinit_tokenizer`, or right away on failure.
+internal bool32 init_tokenizer(InitTokenizerStatus* status, Tokenizer* tokenizer, Allocator* allocator, char* file_data, i32 file_size)
 {
-	FILE* file;
-	if (fopen_s(&file, file_path, "rb"))
-	{
-		status->message = string_builder_quick(&allocator->arena, "You received an error in attempting to open `%s`.", file_path);
-		return true;
-	}
-	DEFER { fclose(file); };
-
-	fseek(file, 0, SEEK_END);
-	tokenizer->file_size = ftell(file);
-	tokenizer->file_data = reinterpret_cast<char*>(malloc(tokenizer->file_size));
-	fseek(file, 0, SEEK_SET);
-	fread(tokenizer->file_data, sizeof(char), tokenizer->file_size, file);
-
+	tokenizer->file_size                          = file_size;
+	tokenizer->file_data                          = file_data;
 	tokenizer->index_in_current_token_buffer_node = 0;
 	tokenizer->head_token_buffer_node             = init_token_buffer_node(allocator);
 	tokenizer->current_token_buffer_node          = tokenizer->head_token_buffer_node;
@@ -324,44 +758,28 @@ internal bool32 init_tokenizer(InitTokenizerStatus* status, Tokenizer* tokenizer
 			}
 			else
 			{
-				constexpr struct { strlit cstring; TokenKind kind; } RESERVED[] =
-					{
-						{ "ASSERT", TokenKind::assertion         },
-						{ ";"     , TokenKind::semicolon         },
-						{ "="     , TokenKind::equal             },
-						{ ","     , TokenKind::comma             },
-						{ "+"     , TokenKind::plus              },
-						{ "-"     , TokenKind::minus             },
-						{ "*"     , TokenKind::asterisk          },
-						{ "/"     , TokenKind::forward_slash     },
-						{ "^"     , TokenKind::caret             },
-						{ "!"     , TokenKind::exclamation_point },
-						{ "("     , TokenKind::parenthesis_start },
-						{ ")"     , TokenKind::parenthesis_end   }
-					};
-
-				FOR_ELEMS(RESERVED)
+				// @NOTE@ Longest match of the reserved words and operators with the DFA generated into `meta/lexer.h`.
+				i32 state = LEXER_START_STATE;
+				token->string.size = 0;
+				for (i32 size = 0; current_index + size < tokenizer->file_size; size += 1)
 				{
-					token->kind        = it->kind;
-					token->string.size = 0;
-
-					while (current_index + token->string.size < tokenizer->file_size)
+					state = LEXER_TRANSITIONS[state][LEXER_BYTE_CLASSES[static_cast<u8>(tokenizer->file_data[current_index + size])]];
+					if (!state)
 					{
-						if (tokenizer->file_data[current_index + token->string.size] == it->cstring[token->string.size])
-						{
-							token->string.size += 1;
-							if (it->cstring[token->string.size] == '\0')
-							{
-								goto PROCESS_TOKEN;
-							}
-						}
-						else
-						{
-							break;
-						}
+						break;
+					}
+					else if (LEXER_ACCEPTED_KINDS[state] != TokenKind::eof)
+					{
+						token->kind        = LEXER_ACCEPTED_KINDS[state];
+						token->string.size = size + 1;
 					}
 				}
 
+				if (token->string.size)
+				{
+					goto PROCESS_TOKEN;
+				}
+
 				if (is_alpha(tokenizer->file_data[current_index]) || tokenizer->file_data[current_index] == '_')
 				{
 					token->kind        = TokenKind::identifier;
@@ -401,6 +819,25 @@ internal bool32 init_tokenizer(InitTokenizerStatus* status, Tokenizer* tokenizer
 	return false;
 }
 
+internal bool32 init_tokenizer(InitTokenizerStatus* status, Tokenizer* tokenizer, Allocator* allocator, strlit file_path)
+{
+	FILE* file;
+	if (fopen_s(&file, file_path, "rb"))
+	{
+		status->message = string_builder_quick(&allocator->arena, "You received an error in attempting to open `%s`.", file_path);
+		return true;
+	}
+	DEFER { fclose(file); };
+
+	fseek(file, 0, SEEK_END);
+	i32   file_size = ftell(file);
+	char* file_data = reinterpret_cast<char*>(malloc(file_size));
+	fseek(file, 0, SEEK_SET);
+	fread(file_data, sizeof(char), file_size, file);
+
+	return init_tokenizer(status, tokenizer, allocator, file_data, file_size);
+}
+
 // @TODO@ Avoid copy.
 internal Token peek_token(Tokenizer* tokenizer)
 {
@@ -438,6 +875,7 @@ internal Token eat_token(Tokenizer* tokenizer)
 
 enum struct Associativity : u8
 {
+	none,
 	prefix,
 	postfix,
 	binary_left_associative,
@@ -450,195 +888,266 @@ struct TokenOrder
 	i32           precedence;
 };
 
-internal bool32 try_get_token_order(TokenOrder* token_order, TokenKind kind)
-{
-	switch (kind)
+// @NOTE@ Indexed by `TokenKind`. Tokens that are not operators have no associativity.
+global constexpr TokenOrder TOKEN_ORDERS[] =
 	{
-		case TokenKind::exclamation_point:
-		token_order->associativity = Associativity::postfix;
-		token_order->precedence    = 7;
-		return true;
-
-		case TokenKind::caret:
-		token_order->associativity = Associativity::binary_right_associative;
-		token_order->precedence    = 6;
-		return true;
+		{ Associativity::none                    , 0 }, // eof
+		{ Associativity::prefix                  , 0 }, // assertion
+		{ Associativity::none                    , 0 }, // identifier
+		{ Associativity::none                    , 0 }, // number
+		{ Associativity::none                    , 0 }, // semicolon
+		{ Associativity::none                    , 0 }, // parenthesis_start
+		{ Associativity::none                    , 0 }, // parenthesis_end
+		{ Associativity::binary_left_associative , 5 }, // parenthetical_application
+		{ Associativity::none                    , 0 }, // inlined_application
+		{ Associativity::binary_left_associative , 1 }, // equal
+		{ Associativity::binary_right_associative, 2 }, // comma
+		{ Associativity::binary_left_associative , 3 }, // plus
+		{ Associativity::binary_left_associative , 3 }, // minus
+		{ Associativity::binary_left_associative , 4 }, // asterisk
+		{ Associativity::binary_left_associative , 4 }, // forward_slash
+		{ Associativity::binary_right_associative, 6 }, // caret
+		{ Associativity::postfix                 , 7 }, // exclamation_point
+		{ Associativity::none                    , 0 }, // bracket_start
+		{ Associativity::none                    , 0 }, // bracket_end
+		{ Associativity::binary_right_associative, 2 }, // colon
+		{ Associativity::none                    , 0 }  // array
+	};
+static_assert(ARRAY_CAPACITY(TOKEN_ORDERS) == static_cast<i32>(TokenKind::array) + 1);
 
-		case TokenKind::parenthetical_application:
-		token_order->associativity = Associativity::binary_left_associative;
-		token_order->precedence    = 5;
-		return true;
+global constexpr Token PARENTHETICAL_APPLICATION_TOKEN = { TokenKind::parenthetical_application, STRING_VIEW_OF("()") };
+global constexpr Token MULTIPLICATION_TOKEN            = { TokenKind::asterisk                 , STRING_VIEW_OF("*")  };
+global constexpr Token ARRAY_TOKEN                     = { TokenKind::array                    , STRING_VIEW_OF("[]") };
 
-		case TokenKind::asterisk:
-		case TokenKind::forward_slash:
-		token_order->associativity = Associativity::binary_left_associative;
-		token_order->precedence    = 4;
-		return true;
+internal constexpr TokenOrder get_token_order(TokenKind kind)
+{
+	return TOKEN_ORDERS[static_cast<i32>(kind)];
+}
 
-		case TokenKind::plus:
-		case TokenKind::minus:
-		token_order->associativity = Associativity::binary_left_associative;
-		token_order->precedence    = 3;
-		return true;
+// @NOTE@ The minimum precedence of the right-hand side of a binary operator.
+internal constexpr i32 get_right_hand_side_precedence(TokenKind kind)
+{
+	return get_token_order(kind).precedence + (get_token_order(kind).associativity == Associativity::binary_right_associative ? 0 : 1);
+}
 
-		case TokenKind::comma:
-		token_order->associativity = Associativity::binary_right_associative;
-		token_order->precedence    = 2;
-		return true;
+internal ParserFrameBufferNode* init_parser_frame_buffer_node(Allocator* allocator)
+{
+	allocator->allocated_parser_frame_buffer_node_count += 1;
 
-		case TokenKind::equal:
-		token_order->associativity = Associativity::binary_left_associative;
-		token_order->precedence    = 1;
-		return true;
+	ParserFrameBufferNode* allocation = memory_arena_allocate_from_available(&allocator->available_parser_frame_buffer_node, &allocator->arena);
+	*allocation = {};
+	return allocation;
+}
 
-		case TokenKind::assertion:
-		token_order->associativity = Associativity::prefix;
-		token_order->precedence    = 0;
-		return true;
-	}
+internal void deinit_single_parser_frame_buffer_node(Allocator* allocator, ParserFrameBufferNode* node)
+{
+	push_single_node(node, &allocator->available_parser_frame_buffer_node);
 
-	return false;
+	allocator->allocated_parser_frame_buffer_node_count -= 1;
+	ASSERT(allocator->allocated_parser_frame_buffer_node_count >= 0);
 }
 
-// @NOTE@ https://eli.thegreenplace.net/2012/08/02/parsing-expressions-by-precedence-climbing
-internal SyntaxTree* eat_syntax_tree(Tokenizer* tokenizer, Ledger* ledger, Allocator* allocator, i32 min_precedence = 0)
+internal ParserFrame* push_parser_frame(ParserFrameBufferNode** stack, Allocator* allocator, i32 min_precedence)
 {
-	// @TODO@ Clean up.
-	Token parenthetical_application_token;
-	parenthetical_application_token.kind   = TokenKind::parenthetical_application;
-	parenthetical_application_token.string = STRING_VIEW_OF("()");
-	TokenOrder parenthetical_application_order;
-	bool32 parenthetical_application_has_order = try_get_token_order(&parenthetical_application_order, TokenKind::parenthetical_application);
-	ASSERT(parenthetical_application_has_order);
+	if (!*stack || (*stack)->count == ARRAY_CAPACITY((*stack)->buffer))
+	{
+		push_single_node(init_parser_frame_buffer_node(allocator), stack);
+	}
 
-	Token multiplication_token;
-	multiplication_token.kind   = TokenKind::asterisk;
-	multiplication_token.string = STRING_VIEW_OF("*");
-	TokenOrder multiplication_order;
-	bool32 multiplication_has_order = try_get_token_order(&multiplication_order, TokenKind::asterisk);
-	ASSERT(multiplication_has_order);
+	ParserFrame* frame = &(*stack)->buffer[(*stack)->count];
+	(*stack)->count += 1;
 
-	SyntaxTree* current_tree;
+	*frame = {};
+	frame->min_precedence = min_precedence;
+	return frame;
+}
 
+// @NOTE@ Returns the new top frame, or null when the stack is empty.
+internal ParserFrame* pop_parser_frame(ParserFrameBufferNode** stack, Allocator* allocator)
+{
+	(*stack)->count -= 1;
+	if (!(*stack)->count)
 	{
-		Token      token = peek_token(tokenizer);
-		TokenOrder token_order;
-		if (token.kind == TokenKind::minus)
-		{
-			eat_token(tokenizer);
-			current_tree = init_single_syntax_tree(allocator, token, 0, eat_syntax_tree(tokenizer, ledger, allocator, multiplication_order.precedence + (multiplication_order.associativity == Associativity::binary_right_associative ? 0 : 1)));
-			ASSERT(current_tree->right);
-		}
-		else if (try_get_token_order(&token_order, token.kind) && token_order.associativity == Associativity::prefix && token_order.precedence >= min_precedence)
-		{
-			eat_token(tokenizer);
-			current_tree = init_single_syntax_tree(allocator, token, 0, eat_syntax_tree(tokenizer, ledger, allocator, token_order.precedence + 1));
-			ASSERT(current_tree->right);
-		}
-		else if (token.kind == TokenKind::parenthesis_start)
-		{
-			eat_token(tokenizer);
-			current_tree = eat_syntax_tree(tokenizer, ledger, allocator, 0);
-			ASSERT(current_tree);
-			token = eat_token(tokenizer);
-			ASSERT(token.kind == TokenKind::parenthesis_end);
-			current_tree = init_single_syntax_tree(allocator, parenthetical_application_token, 0, current_tree);
-		}
-		else if (token.kind == TokenKind::number || token.kind == TokenKind::identifier)
-		{
-			eat_token(tokenizer);
-			current_tree = init_single_syntax_tree(allocator, token, 0, 0);
-		}
-		else
-		{
-			return 0;
-		}
+		deinit_single_parser_frame_buffer_node(allocator, pop_node(stack));
 	}
 
+	return *stack ? &(*stack)->buffer[(*stack)->count - 1] : 0;
+}
+
+struct EatStatementStatus
+{
+	StringView message;
+};
+
+// @NOTE@ https://eli.thegreenplace.net/2012/08/02/parsing-expressions-by-precedence-climbing
+// Precedence climbing with the recursion replaced by an explicit stack of frames. A frame is what used to be one call: it holds the
+// operand parsed so far and the operator waiting on the operand that the frame above it is parsing. When a frame runs out of operators,
+// it is popped and its operand is joined to the waiting operator below it. Returns null on malformed input, having freed everything
+// parsed so far.
+internal SyntaxTree* eat_syntax_tree(EatStatementStatus* status, Tokenizer* tokenizer, Ledger* ledger, Allocator* allocator, i32 min_precedence = 0)
+{
+	ParserFrameBufferNode* stack                = 0;
+	ParserFrame*           frame                = push_parser_frame(&stack, allocator, min_precedence);
+	bool32                 is_expecting_operand = true;
+
+	lambda abort =
+		[&](SyntaxTree* operand, StringView message)
+		{
+			status->message = message;
+			deinit_entire_syntax_tree(allocator, operand);
+			for (ParserFrame* it = frame; it; it = pop_parser_frame(&stack, allocator))
+			{
+				deinit_entire_syntax_tree(allocator, it->tree);
+			}
+			return static_cast<SyntaxTree*>(0);
+		};
+
 	while (true)
 	{
-		Token      token = peek_token(tokenizer);
-		TokenOrder token_order;
-		if (try_get_token_order(&token_order, token.kind) && token_order.precedence >= min_precedence)
-		{
-			eat_token(tokenizer);
+		Token       token       = peek_token(tokenizer);
+		TokenOrder  token_order = get_token_order(token.kind);
+		SyntaxTree* operand     = 0;
 
-			switch (token_order.associativity)
+		if (is_expecting_operand)
+		{
+			if (token.kind == TokenKind::minus)
 			{
-				case Associativity::binary_left_associative:
-				{
-					current_tree = init_single_syntax_tree(allocator, token, current_tree, eat_syntax_tree(tokenizer, ledger, allocator, token_order.precedence + 1));
-					ASSERT(current_tree->right);
-				} break;
+				eat_token(tokenizer);
+				frame->token = token;
+				frame        = push_parser_frame(&stack, allocator, get_right_hand_side_precedence(TokenKind::asterisk));
+				continue;
+			}
+			else if (token_order.associativity == Associativity::prefix && token_order.precedence >= frame->min_precedence)
+			{
+				eat_token(tokenizer);
+				frame->token = token;
+				frame        = push_parser_frame(&stack, allocator, token_order.precedence + 1);
+				continue;
+			}
+			else if (token.kind == TokenKind::parenthesis_start)
+			{
+				eat_token(tokenizer);
+				frame->token = PARENTHETICAL_APPLICATION_TOKEN;
+				frame        = push_parser_frame(&stack, allocator, 0);
+				continue;
+			}
+			else if (token.kind == TokenKind::bracket_start)
+			{
+				eat_token(tokenizer);
+				frame->token = ARRAY_TOKEN;
+				frame        = push_parser_frame(&stack, allocator, 0);
+				continue;
+			}
+			else if (token.kind == TokenKind::number || token.kind == TokenKind::identifier)
+			{
+				eat_token(tokenizer);
+				frame->tree          = init_single_syntax_tree(allocator, token, 0, 0);
+				is_expecting_operand = false;
+				continue;
+			}
+		}
+		else
+		{
+			if (token_order.associativity != Associativity::none && token_order.precedence >= frame->min_precedence)
+			{
+				eat_token(tokenizer);
 
-				case Associativity::binary_right_associative:
+				switch (token_order.associativity)
 				{
-					current_tree = init_single_syntax_tree(allocator, token, current_tree, eat_syntax_tree(tokenizer, ledger, allocator, token_order.precedence));
-					ASSERT(current_tree->right);
-				} break;
+					case Associativity::binary_left_associative:
+					case Associativity::binary_right_associative:
+					{
+						frame->token         = token;
+						frame                = push_parser_frame(&stack, allocator, get_right_hand_side_precedence(token.kind));
+						is_expecting_operand = true;
+					} break;
 
-				case Associativity::postfix:
-				{
-					current_tree = init_single_syntax_tree(allocator, token, current_tree, 0);
-				} break;
+					case Associativity::postfix:
+					{
+						frame->tree = init_single_syntax_tree(allocator, token, frame->tree, 0);
+					} break;
 
-				case Associativity::prefix:
-				{
-					ASSERT(false); // Prefix operator encountered after atom.
-				} break;
+					default:
+					{
+						return abort(0, string_builder_quick(&allocator->arena, "`%.*s` can't come after an operand.", PASS_STRING_VIEW(token.string)));
+					} break;
+				}
+
+				continue;
+			}
+			else if (token.kind == TokenKind::parenthesis_start && get_token_order(TokenKind::parenthetical_application).precedence >= frame->min_precedence)
+			{
+				eat_token(tokenizer);
+				frame->token         = PARENTHETICAL_APPLICATION_TOKEN;
+				frame                = push_parser_frame(&stack, allocator, 0);
+				is_expecting_operand = true;
+				continue;
+			}
+			else if // @TODO@ Might be bugged?
+			(
+				(token.kind == TokenKind::number && (frame->tree->token.kind == TokenKind::identifier || frame->tree->token.kind == TokenKind::parenthetical_application))
+				|| token.kind == TokenKind::identifier && get_token_order(TokenKind::parenthetical_application).precedence >= frame->min_precedence
+			)
+			{
+				frame->token         = MULTIPLICATION_TOKEN;
+				frame                = push_parser_frame(&stack, allocator, get_right_hand_side_precedence(TokenKind::asterisk));
+				is_expecting_operand = true;
+				continue;
+			}
+
+			operand = frame->tree;
+		}
+
+		frame = pop_parser_frame(&stack, allocator);
+		if (!operand && !(frame && frame->token.kind == TokenKind::parenthetical_application && frame->tree)) // @NOTE@ `f()` has no arguments.
+		{
+			if (frame && frame->token.kind == TokenKind::array)
+			{
+				return abort(0, STRING_VIEW_OF("Arrays can't be empty."));
+			}
+			else if (token.kind == TokenKind::eof)
+			{
+				return abort(0, STRING_VIEW_OF("The ledger ends where an operand was expected."));
+			}
+			else
+			{
+				return abort(0, string_builder_quick(&allocator->arena, "I expected an operand before `%.*s`.", PASS_STRING_VIEW(token.string)));
 			}
 		}
-		else if (token.kind == TokenKind::parenthesis_start && parenthetical_application_order.precedence >= min_precedence)
+		else if (!frame)
 		{
-			eat_token(tokenizer);
-			SyntaxTree* right_hand_side = eat_syntax_tree(tokenizer, ledger, allocator, 0);
-			token = eat_token(tokenizer);
-			ASSERT(token.kind == TokenKind::parenthesis_end);
-			current_tree = init_single_syntax_tree(allocator, parenthetical_application_token, current_tree, right_hand_side);
+			return operand;
 		}
-		else if // @TODO@ Might be bugged?
-		(
-			(token.kind == TokenKind::number && (current_tree->token.kind == TokenKind::identifier || current_tree->token.kind == TokenKind::parenthetical_application))
-			|| token.kind == TokenKind::identifier && parenthetical_application_order.precedence >= min_precedence
-		)
+
+		if (frame->token.kind == TokenKind::parenthetical_application && eat_token(tokenizer).kind != TokenKind::parenthesis_end)
 		{
-			current_tree = init_single_syntax_tree(allocator, multiplication_token, current_tree, eat_syntax_tree(tokenizer, ledger, allocator, multiplication_order.precedence + (multiplication_order.associativity == Associativity::binary_right_associative ? 0 : 1)));
+			return abort(operand, STRING_VIEW_OF("There is a `(` without a matching `)`."));
 		}
-		else
+		else if (frame->token.kind == TokenKind::array && eat_token(tokenizer).kind != TokenKind::bracket_end)
 		{
-			break;
+			return abort(operand, STRING_VIEW_OF("There is a `[` without a matching `]`."));
 		}
-	}
-
-	return current_tree;
-}
 
-// @TODO@ Make this more robust.
-internal f32 parse_number(StringView string)
-{
-	char buffer[64];
-	sprintf_s(buffer, sizeof(buffer), "%.*s", PASS_STRING_VIEW(string));
-	f32 result;
-	sscanf_s(buffer, "%f", &result);
-	return result;
+		frame->tree          = init_single_syntax_tree(allocator, frame->token, frame->tree, operand);
+		is_expecting_operand = false;
+	}
 }
 
 internal bool32 is_name_defined(StringView name, Ledger* ledger)
 {
-	FOR_ELEMS(PREDEFINED_CONSTANTS)
+	if (find_predefined_constant(name))
 	{
-		if (it->name == name)
-		{
-			return true;
-		}
+		return true;
 	}
 
-	FOR_ELEMS(PREDEFINED_FUNCTIONS)
+	if (find_predefined_function(name))
 	{
-		if (it->name == name)
-		{
-			return true;
-		}
+		return true;
+	}
+
+	if (find_functional(name))
+	{
+		return true;
 	}
 
 	FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
@@ -656,375 +1165,2391 @@ internal bool32 is_name_defined(StringView name, Ledger* ledger)
 	return false;
 };
 
-#if DEBUG
-internal void DEBUG_print_syntax_tree(SyntaxTree* tree, i32 depth = 0, u64 path = 0)
+internal Statement* find_function_declaration(Ledger* ledger, StringView name)
 {
-	if (tree)
+	if (find_predefined_function(name))
 	{
-		if (!tree->left && !tree->right)
-		{
-			printf("Leaf : ");
-			FOR_RANGE(i, depth)
-			{
-				printf("%llu", (path >> i) & 0b1);
-			}
+		return 0;
+	}
 
-			printf(" : `%.*s`\n", PASS_STRING_VIEW(tree->token.string));
-		}
-		else
+	FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+	{
+		if (it->type == StatementType::function_declaration && it->tree->left->left->token.string == name)
 		{
-			printf("Branch : ");
-			FOR_RANGE(i, depth)
-			{
-				printf("%llu", (path >> i) & 0b1);
-			}
-			printf(" : `%.*s`\n", PASS_STRING_VIEW(tree->token.string));
+			return it;
+		}
+	}
 
-			if (tree->left)
-			{
-				DEBUG_print_syntax_tree(tree->left, depth + 1, path & ~(1ULL << depth));
-			}
-			if (tree->right)
-			{
-				DEBUG_print_syntax_tree(tree->right, depth + 1, path | (1ULL << depth));
-			}
+	return 0;
+}
+
+internal i32 count_application_arguments(SyntaxTree* tree)
+{
+	i32 count = 0;
+	for (SyntaxTree* current = tree->right; current; current = current->token.kind == TokenKind::comma ? current->right : 0)
+	{
+		count += 1;
+	}
+	return count;
+}
+
+// @NOTE@ Returns the first call of a built-in that is given a different number of arguments than its arity. The thunks of the built-ins
+// and the functionals trust the arity, so this is checked once here rather than on every call.
+internal SyntaxTree* find_arity_mismatch(SyntaxTree* tree)
+{
+	if (!tree)
+	{
+		return 0;
+	}
+
+	if (tree->token.kind == TokenKind::parenthetical_application && tree->left && tree->left->token.kind == TokenKind::identifier)
+	{
+		i32 arity = get_builtin_arity(tree->left->token.string);
+		if (arity != -1 && arity != count_application_arguments(tree))
+		{
+			return tree;
 		}
 	}
+
+	SyntaxTree* mismatch = find_arity_mismatch(tree->left);
+	return mismatch ? mismatch : find_arity_mismatch(tree->right);
 }
 
-internal void DEBUG_print_serialized_syntax_tree(SyntaxTree* tree)
+// @NOTE@ Returns true on failure, leaving the ledger as it was. Names are only checked against the statements before this one, so that
+// redefinitions are caught; names that are never defined are found by `find_undefined_name` once the whole ledger is parsed.
+internal bool32 eat_statement(EatStatementStatus* status, Statement** result, Tokenizer* tokenizer, Ledger* ledger, Allocator* allocator)
 {
-	if (tree)
+	if (ledger->statement_count == ARRAY_CAPACITY(ledger->statement_buffer))
 	{
-		switch (tree->token.kind)
+		status->message = string_builder_quick(&allocator->arena, "A ledger can't have more than %d statements.", ARRAY_CAPACITY(ledger->statement_buffer));
+		return true;
+	}
+
+	aliasing statement = ledger->statement_buffer[ledger->statement_count];
+	statement = {};
+	statement.tree = eat_syntax_tree(status, tokenizer, ledger, allocator);
+	if (!statement.tree)
+	{
+		return true;
+	}
+
+	lambda abort =
+		[&](StringView message)
 		{
-			case TokenKind::number:
-			case TokenKind::identifier:
+			status->message = message;
+			deinit_entire_syntax_tree(allocator, statement.tree);
+			if (statement.type == StatementType::function_declaration)
 			{
-				printf("%.*s", PASS_STRING_VIEW(tree->token.string));
-			} break;
+				deinit_entire_function_argument_node(allocator, statement.function_declaration.args);
+			}
+			statement = {};
+			return true;
+		};
 
-			case TokenKind::plus:
-			{
-				DEBUG_print_serialized_syntax_tree(tree->left);
-				printf(" + ");
-				DEBUG_print_serialized_syntax_tree(tree->right);
-			} break;
+	if (statement.tree->token.kind == TokenKind::assertion)
+	{
+		if
+		(
+			!ledger->statement_count ||
+			(
+				ledger->statement_buffer[ledger->statement_count - 1].type != StatementType::expression &&
+				ledger->statement_buffer[ledger->statement_count - 1].type != StatementType::variable_declaration
+			)
+		)
+		{
+			return abort(STRING_VIEW_OF("`ASSERT` must follow an expression or a variable declaration."));
+		}
 
-			case TokenKind::minus:
+		statement.type                              = StatementType::assertion;
+		statement.assertion.corresponding_statement = &ledger->statement_buffer[ledger->statement_count - 1];
+	}
+	else if (statement.tree->token.kind == TokenKind::equal)
+	{
+		if (statement.tree->left->token.kind == TokenKind::parenthetical_application)
+		{
+			if (!statement.tree->left->left || statement.tree->left->left->token.kind != TokenKind::identifier || !statement.tree->left->right)
 			{
-				if (tree->left)
-				{
-					DEBUG_print_serialized_syntax_tree(tree->left);
-					printf(" - ");
-					DEBUG_print_serialized_syntax_tree(tree->right);
-				}
-				else
-				{
-					printf("-");
-					DEBUG_print_serialized_syntax_tree(tree->right);
-				}
-			} break;
+				return abort(STRING_VIEW_OF("A function is declared by its name and its parameters, as in `f(x, y) = ...`."));
+			}
+			else if (is_name_defined(statement.tree->left->left->token.string, ledger))
+			{
+				return abort(string_builder_quick(&allocator->arena, "`%.*s` is already defined.", PASS_STRING_VIEW(statement.tree->left->left->token.string)));
+			}
 
-			case TokenKind::asterisk:
+			statement.type = StatementType::function_declaration;
+
+			FunctionArgumentNode** args_nil = &statement.function_declaration.args;
+			for (SyntaxTree* tree = statement.tree->left->right; tree; tree = tree->right)
 			{
-				if (tree->left->token.kind == TokenKind::parenthetical_application || tree->right->token.kind == TokenKind::parenthetical_application)
+				SyntaxTree* parameter = tree->token.kind == TokenKind::comma ? tree->left : tree;
+				if (parameter->token.kind != TokenKind::identifier)
 				{
-					DEBUG_print_serialized_syntax_tree(tree->left);
-					DEBUG_print_serialized_syntax_tree(tree->right);
+					return abort(string_builder_quick(&allocator->arena, "The parameter `%.*s` is not a name.", PASS_STRING_VIEW(parameter->token.string)));
 				}
-				else
+
+				*args_nil = init_function_argument_node(allocator, parameter->token.string);
+				if (tree->token.kind != TokenKind::comma)
 				{
-					DEBUG_print_serialized_syntax_tree(tree->left);
-					printf(" * ");
-					DEBUG_print_serialized_syntax_tree(tree->right);
+					break;
 				}
-			} break;
 
-			case TokenKind::forward_slash:
-			{
-				DEBUG_print_serialized_syntax_tree(tree->left);
-				printf("/");
-				DEBUG_print_serialized_syntax_tree(tree->right);
-			} break;
-
-			case TokenKind::caret:
-			{
-				DEBUG_print_serialized_syntax_tree(tree->left);
-				printf("^");
-				DEBUG_print_serialized_syntax_tree(tree->right);
-			} break;
-
-			case TokenKind::exclamation_point:
-			{
-				DEBUG_print_serialized_syntax_tree(tree->left);
-				printf("!");
-			} break;
+				args_nil  = &(*args_nil)->next_node;
+			}
+		}
+		else
+		{
+			// @TODO@ `x = x` is not noticed as ill-formed.
 
-			case TokenKind::parenthetical_application:
+			if (statement.tree->left->token.kind != TokenKind::identifier)
 			{
-				DEBUG_print_serialized_syntax_tree(tree->left);
-				printf("(");
-				DEBUG_print_serialized_syntax_tree(tree->right);
-				printf(")");
-			} break;
-
-			case TokenKind::equal:
+				return abort(string_builder_quick(&allocator->arena, "`%.*s` can't be assigned to.", PASS_STRING_VIEW(statement.tree->left->token.string)));
+			}
+			else if (is_name_defined(statement.tree->left->token.string, ledger))
 			{
-				DEBUG_print_serialized_syntax_tree(tree->left);
-				printf(" = ");
-				DEBUG_print_serialized_syntax_tree(tree->right);
-			} break;
+				return abort(string_builder_quick(&allocator->arena, "`%.*s` is already defined.", PASS_STRING_VIEW(statement.tree->left->token.string)));
+			}
 
-			case TokenKind::comma:
-			{
-				DEBUG_print_serialized_syntax_tree(tree->left);
-				printf(", ");
-				DEBUG_print_serialized_syntax_tree(tree->right);
-			} break;
+			statement.type = StatementType::variable_declaration;
 		}
 	}
-}
+	else
+	{
+		statement.type = StatementType::expression;
+	}
 
-internal bool32 DEBUG_token_eq(Token a, Token b)
-{
-	return a.kind == b.kind && memcmp(a.string.data, b.string.data, a.string.size) == 0;
+	if (eat_token(tokenizer).kind != TokenKind::semicolon)
+	{
+		return abort(STRING_VIEW_OF("A statement must end with `;`."));
+	}
+
+	ledger->statement_count += 1;
+	*result                  = &statement;
+	return false;
 }
 
-internal bool32 DEBUG_syntax_tree_eq(SyntaxTree* a, SyntaxTree* b)
+struct CheckLedgerStatus
 {
-	if (a == b)
+	StringView message;
+};
+
+internal bool32 is_value_name(StringView name, FunctionArgumentNode* parameters, Ledger* ledger)
+{
+	FOR_NODES(parameters)
 	{
-		return true;
+		if (it->name == name)
+		{
+			return true;
+		}
 	}
-	else if (a && b)
+
+	if (find_predefined_constant(name))
 	{
-		return DEBUG_token_eq(a->token, b->token) && DEBUG_syntax_tree_eq(a->left, b->left) && DEBUG_syntax_tree_eq(a->right, b->right);
+		return true;
 	}
-	else
+
+	FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
 	{
-		return false;
+		if (it->type == StatementType::variable_declaration && it->tree->left->token.string == name)
+		{
+			return true;
+		}
 	}
+
+	return false;
 }
-#endif
 
-internal void evaluate_statement(Statement* statement, Ledger* ledger, Allocator* allocator, FunctionArgumentNode* binded_args = 0)
+// @NOTE@ Resolves every name the way `evaluate_statement` will: a name being called is a functional, a built-in or a function, and
+// otherwise multiplies what follows it, and any other name is a parameter, a constant or a variable. The arity of the built-ins has
+// already been checked by `find_arity_mismatch`.
+internal bool32 check_syntax_tree_names(CheckLedgerStatus* status, SyntaxTree* tree, FunctionArgumentNode* parameters, Ledger* ledger, Allocator* allocator)
 {
-	lambda evaluate_expression =
-		[&](SyntaxTree* tree)
+	if (!tree)
+	{
+		return false;
+	}
+	else if (tree->token.kind == TokenKind::identifier)
+	{
+		if (!is_value_name(tree->token.string, parameters, ledger))
 		{
-			Statement exp = {};
-			exp.tree = tree;
-			exp.type = StatementType::expression;
-			evaluate_statement(&exp, ledger, allocator, binded_args);
-			ASSERT(exp.expression.is_cached);
-			return exp.expression.cached_evaluation;
-		};
-
-	switch (statement->type)
+			status->message =
+				is_name_defined(tree->token.string, ledger)
+					? string_builder_quick(&allocator->arena, "`%.*s` is a function, so it must be given its arguments.", PASS_STRING_VIEW(tree->token.string))
+					: string_builder_quick(&allocator->arena, "`%.*s` is not defined.", PASS_STRING_VIEW(tree->token.string));
+			return true;
+		}
+		return false;
+	}
+	else if (tree->token.kind == TokenKind::equal || tree->token.kind == TokenKind::assertion)
 	{
-		case StatementType::assertion:
+		status->message = string_builder_quick(&allocator->arena, "`%.*s` can only begin a statement.", PASS_STRING_VIEW(tree->token.string));
+		return true;
+	}
+	else if (tree->token.kind == TokenKind::parenthetical_application && tree->left && tree->left->token.kind == TokenKind::identifier)
+	{
+		StringView name = tree->left->token.string;
+		if (find_functional(name))
 		{
-			evaluate_statement(statement->assertion.corresponding_statement, ledger, allocator);
-			f32 expectant_value = parse_number(statement->tree->right->token.string);
-			f32 resultant_value = NAN;
-
-			switch (statement->assertion.corresponding_statement->type)
+			Statement* function = tree->right->left->token.kind == TokenKind::identifier ? find_function_declaration(ledger, tree->right->left->token.string) : 0;
+			if (!function || function->function_declaration.args->next_node)
 			{
-				case StatementType::expression:
-				{
-					ASSERT(statement->assertion.corresponding_statement->expression.is_cached);
-					resultant_value = statement->assertion.corresponding_statement->expression.cached_evaluation;
-				} break;
-
-				case StatementType::variable_declaration:
-				{
-					ASSERT(statement->assertion.corresponding_statement->variable_declaration.status == VariableDeclarationStatus::cached);
-					resultant_value = statement->assertion.corresponding_statement->variable_declaration.cached_evaluation;
-				} break;
-
-				default:
-				{
-					ASSERT(false); // Unknown assertion case.
-				} break;
+				status->message = string_builder_quick(&allocator->arena, "`%.*s` takes the name of a function of one parameter first.", PASS_STRING_VIEW(name));
+				return true;
+			}
+			return check_syntax_tree_names(status, tree->right->right, parameters, ledger, allocator);
+		}
+		else if (find_predefined_function(name))
+		{
+			return check_syntax_tree_names(status, tree->right, parameters, ledger, allocator);
+		}
+		else if (Statement* function = find_function_declaration(ledger, name))
+		{
+			i32 parameter_count = 0;
+			FOR_NODES(function->function_declaration.args)
+			{
+				parameter_count += 1;
 			}
 
-			if (fabsf(resultant_value - expectant_value) < 0.000001f)
+			i32 argument_count = count_application_arguments(tree);
+			if (argument_count != parameter_count)
 			{
-				printf("Passed assertion :: %f :: ", expectant_value);
-				DEBUG_print_serialized_syntax_tree(statement->assertion.corresponding_statement->tree);
-				printf("\n");
+				status->message = string_builder_quick(&allocator->arena, "`%.*s` takes %d argument(s) but was given %d.", PASS_STRING_VIEW(name), parameter_count, argument_count);
+				return true;
 			}
-			else
+			return check_syntax_tree_names(status, tree->right, parameters, ledger, allocator);
+		}
+	}
+
+	return check_syntax_tree_names(status, tree->left, parameters, ledger, allocator) || check_syntax_tree_names(status, tree->right, parameters, ledger, allocator);
+}
+
+// @NOTE@ Whether evaluating the tree can come back to `target`. Names are resolved as in `check_syntax_tree_names`.
+internal bool32 does_reach_statement(Statement* target, SyntaxTree* tree, FunctionArgumentNode* parameters, Ledger* ledger, u64* visited_mask)
+{
+	if (!tree)
+	{
+		return false;
+	}
+
+	SyntaxTree* name = 0;
+	if (tree->token.kind == TokenKind::identifier)
+	{
+		FOR_NODES(parameters)
+		{
+			if (it->name == tree->token.string)
 			{
-				printf("Failed assertion :: %f :: resultant value :: %f :: ", expectant_value, resultant_value);
-				DEBUG_print_serialized_syntax_tree(statement->assertion.corresponding_statement->tree);
-				printf("\n");
-				ASSERT(false); // Failed meat assertion.
+				return false;
 			}
-		} break;
+		}
+		name = tree;
+	}
+	else if (tree->token.kind == TokenKind::parenthetical_application && tree->left && tree->left->token.kind == TokenKind::identifier)
+	{
+		name = tree->left;
+	}
 
-		case StatementType::expression:
+	if (name)
+	{
+		FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
 		{
-			if (!statement->expression.is_cached)
+			if
+			(
+				(it->type == StatementType::variable_declaration && it->tree->left->token.string       == name->token.string) ||
+				(it->type == StatementType::function_declaration && it->tree->left->left->token.string == name->token.string)
+			)
 			{
-				switch (statement->tree->token.kind)
+				if (it == target)
 				{
-					case TokenKind::identifier:
-					{
-						ASSERT(!statement->tree->left);
-						ASSERT(!statement->tree->right);
-
-						FOR_NODES(binded_args)
-						{
-							if (it->name == statement->tree->token.string)
-							{
-								statement->expression.cached_evaluation = it->value;
-								statement->expression.is_cached         = true;
-								return;
-							}
-						}
+					return true;
+				}
 
-						FOR_ELEMS(PREDEFINED_CONSTANTS)
-						{
-							if (it->name == statement->tree->token.string)
-							{
-								statement->expression.cached_evaluation = it->value.number;
-								statement->expression.is_cached         = true;
-								return;
-							}
-						}
+				u64 bit = 1ULL << it_index;
+				if (!(*visited_mask & bit))
+				{
+					*visited_mask |= bit;
+					if (does_reach_statement(target, it->tree->right, it->type == StatementType::function_declaration ? it->function_declaration.args : 0, ledger, visited_mask))
+					{
+						return true;
+					}
+				}
+				break;
+			}
+		}
+	}
 
-						FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
-						{
-							if (it->type == StatementType::variable_declaration && it->tree->left->token.string == statement->tree->token.string)
-							{
-								evaluate_statement(it, ledger, allocator);
-								statement->expression.cached_evaluation = it->variable_declaration.cached_evaluation;
-								statement->expression.is_cached         = true;
-								return;
-							}
-						}
+	return does_reach_statement(target, tree->left, parameters, ledger, visited_mask) || does_reach_statement(target, tree->right, parameters, ledger, visited_mask);
+}
 
-						ASSERT(false); // Couldn't find declaration.
-					} break;
+// @NOTE@ Checks what can only be checked once every statement is parsed: that every name is defined and used as what it is, and that
+// no declaration depends on itself. Functions can't branch, so a recursive one never returns. Returns true on failure.
+internal bool32 check_ledger(CheckLedgerStatus* status, Ledger* ledger, Allocator* allocator)
+{
+	FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+	{
+		switch (it->type)
+		{
+			case StatementType::expression:
+			{
+				if (check_syntax_tree_names(status, it->tree, 0, ledger, allocator))
+				{
+					return true;
+				}
+			} break;
 
-					case TokenKind::number:
-					{
-						ASSERT(!statement->tree->left);
-						ASSERT(!statement->tree->right);
-						statement->expression.cached_evaluation = parse_number(statement->tree->token.string);
-						statement->expression.is_cached         = true;
-					} break;
+			case StatementType::variable_declaration:
+			case StatementType::function_declaration:
+			{
+				FunctionArgumentNode* parameters = it->type == StatementType::function_declaration ? it->function_declaration.args : 0;
+				if (check_syntax_tree_names(status, it->tree->right, parameters, ledger, allocator))
+				{
+					return true;
+				}
 
-					case TokenKind::plus:
-					{
-						statement->expression.cached_evaluation = evaluate_expression(statement->tree->left) + evaluate_expression(statement->tree->right);
-						statement->expression.is_cached         = true;
-					} break;
+				u64 visited_mask = 0;
+				if (does_reach_statement(it, it->tree->right, parameters, ledger, &visited_mask))
+				{
+					StringView name = it->type == StatementType::function_declaration ? it->tree->left->left->token.string : it->tree->left->token.string;
+					status->message = string_builder_quick(&allocator->arena, "`%.*s` is defined in terms of itself.", PASS_STRING_VIEW(name));
+					return true;
+				}
+			} break;
 
-					case TokenKind::minus:
-					{
-						if (statement->tree->left)
-						{
-							statement->expression.cached_evaluation = evaluate_expression(statement->tree->left) - evaluate_expression(statement->tree->right);
-						}
-						else
-						{
-							statement->expression.cached_evaluation = -evaluate_expression(statement->tree->right);
-						}
-						statement->expression.is_cached = true;
-					} break;
+			case StatementType::assertion:
+			{
+			} break;
+		}
+	}
 
-					case TokenKind::asterisk:
-					{
-						statement->expression.cached_evaluation = evaluate_expression(statement->tree->left) * evaluate_expression(statement->tree->right);
-						statement->expression.is_cached         = true;
-					} break;
+	return false;
+}
 
-					case TokenKind::forward_slash:
-					{
-						statement->expression.cached_evaluation = evaluate_expression(statement->tree->left) / evaluate_expression(statement->tree->right);
-						statement->expression.is_cached         = true;
-					} break;
+//
+// Output.
+//
 
-					case TokenKind::caret:
-					{
-						statement->expression.cached_evaluation = powf(evaluate_expression(statement->tree->left), evaluate_expression(statement->tree->right));
-						statement->expression.is_cached         = true;
-					} break;
+// @NOTE@ Everything for stdout is appended to `output_builder` and written with a single `fwrite` by `flush_output`.
 
-					case TokenKind::exclamation_point:
-					{
-						ASSERT(!statement->tree->right);
-						statement->expression.cached_evaluation = static_cast<f32>(tgamma(evaluate_expression(statement->tree->left) + 1.0));
-						statement->expression.is_cached         = true;
-					} break;
+global StringBuilder output_builder = {}; // @NOTE@ Initialized at the start of `main`.
 
-					case TokenKind::parenthetical_application:
-					{
-						if (statement->tree->left)
-						{
-							if (statement->tree->left->token.kind == TokenKind::identifier)
-							{
-								FOR_ELEMS(PREDEFINED_FUNCTIONS)
-								{
-									if (it->name == statement->tree->left->token.string)
-									{
-										FunctionArgumentNode* arguments = 0;
-										DEFER { deinit_entire_function_argument_node(allocator, arguments); };
+internal void output_char(char c)
+{
+	string_builder_append(&output_builder, c);
+}
 
-										FunctionArgumentNode** arguments_nil = &arguments;
-										for (SyntaxTree* current_parameter_tree = statement->tree->right; current_parameter_tree; current_parameter_tree = current_parameter_tree->right)
-										{
-											if (current_parameter_tree->token.kind == TokenKind::comma)
-											{
-												*arguments_nil = init_function_argument_node(allocator, {}, evaluate_expression(current_parameter_tree->left));
-											}
-											else
-											{
-												*arguments_nil = init_function_argument_node(allocator, {}, evaluate_expression(current_parameter_tree));
-												break;
-											}
+internal void output_string(StringView string)
+{
+	string_builder_append(&output_builder, string);
+}
 
-											arguments_nil = &(*arguments_nil)->next_node;
-										}
+// @NOTE@ Overloaded so that numbers and elements print at their own precision.
+internal void output_number(f32 value)
+{
+	char buffer[32];
+	string_builder_append(&output_builder, { format_f32(buffer, value), buffer });
+}
 
-										statement->expression.cached_evaluation = it->function(arguments).number; // @TODO@ Assumes all values are numbers.
-										statement->expression.is_cached         = true;
-										return;
-									}
-								}
+internal void output_number(f64 value)
+{
+	char buffer[32];
+	string_builder_append(&output_builder, { format_f64(buffer, value), buffer });
+}
 
-								FOR_ELEMS(function, ledger->statement_buffer, ledger->statement_count)
-								{
-									if (function->type == StatementType::function_declaration && function->tree->left->left->token.string == statement->tree->left->token.string)
-									{
-										FunctionArgumentNode* new_binded_args = 0;
-										DEFER { deinit_entire_function_argument_node(allocator, new_binded_args); };
+// @NOTE@ In full, however many digits that takes.
+internal void output_integer(Value value)
+{
+	u32          limb_buffer[2];
+	ValueInteger integer = get_value_integer(value, limb_buffer);
 
-										FunctionArgumentNode** new_binded_args_nil    = &new_binded_args;
-										FunctionArgumentNode*  current_function_arg   = function->function_declaration.args;
-										SyntaxTree*            current_parameter_tree = statement->tree->right;
-										while (true)
-										{
-											if (current_parameter_tree->token.kind == TokenKind::comma)
-											{
-												*new_binded_args_nil = init_function_argument_node(allocator, current_function_arg->name, evaluate_expression(current_parameter_tree->left));
-												current_function_arg = current_function_arg->next_node;
-											}
-											else
-											{
-												*new_binded_args_nil = init_function_argument_node(allocator, current_function_arg->name, evaluate_expression(current_parameter_tree));
-												current_function_arg = current_function_arg->next_node;
-												break;
-											}
+	MemoryArena arena = {};
+	arena.size = get_format_limbs_scratch_size(integer.limb_count) + 10 * static_cast<memsize>(integer.limb_count) + 1;
+	arena.base = reinterpret_cast<byte*>(malloc(arena.size));
 
-											current_parameter_tree = current_parameter_tree->right;
-											new_binded_args_nil    = &(*new_binded_args_nil)->next_node;
-										}
+	MemoryArena scratch = memory_arena_reserve(&arena, get_format_limbs_scratch_size(integer.limb_count));
+	char*       buffer  = memory_arena_allocate<char>(&arena, 10 * integer.limb_count + 1);
+	if (integer.is_negative)
+	{
+		output_char('-');
+	}
+	output_string({ format_limbs(buffer, integer.limbs, integer.limb_count, &scratch), buffer });
 
-										ASSERT(current_function_arg == 0);
+	free(arena.base);
+}
+
+internal void output_value(Value value)
+{
+	if (is_number_value(value))
+	{
+		output_number(unbox_number(value));
+		return;
+	}
+	else if (get_value_type(value) == ValueType::integer)
+	{
+		output_integer(value);
+		return;
+	}
+
+	ValueArray* array = unbox_array(value);
+	output_char('[');
+	FOR_RANGE(i, array->count)
+	{
+		if (i)
+		{
+			output_string(STRING_VIEW_OF(", "));
+		}
+		output_number(array->elements[i]);
+	}
+	output_char(']');
+}
+
+template <typename... ARGUMENTS>
+internal void output_format(strlit format, ARGUMENTS... arguments)
+{
+	string_builder_append(&output_builder, format, arguments...);
+}
+
+internal void flush_output(void)
+{
+	MemoryArena arena = {};
+	arena.size = max(output_builder.size, 1);
+	arena.base = reinterpret_cast<byte*>(malloc(arena.size));
+
+	StringView string = deinit_string_builder(&output_builder, &arena);
+	fwrite(string.data, 1, string.size, stdout);
+	fflush(stdout);
+
+	free(arena.base);
+	output_builder = init_string_builder();
+}
+
+#if DEBUG
+internal void DEBUG_print_syntax_tree(SyntaxTree* tree, i32 depth = 0, u64 path = 0)
+{
+	if (tree)
+	{
+		if (!tree->left && !tree->right)
+		{
+			output_string(STRING_VIEW_OF("Leaf : "));
+			FOR_RANGE(i, depth)
+			{
+				output_char(static_cast<char>('0' + ((path >> i) & 0b1)));
+			}
+
+			output_string(STRING_VIEW_OF(" : `"));
+			output_string(tree->token.string);
+			output_string(STRING_VIEW_OF("`\n"));
+		}
+		else
+		{
+			output_string(STRING_VIEW_OF("Branch : "));
+			FOR_RANGE(i, depth)
+			{
+				output_char(static_cast<char>('0' + ((path >> i) & 0b1)));
+			}
+			output_string(STRING_VIEW_OF(" : `"));
+			output_string(tree->token.string);
+			output_string(STRING_VIEW_OF("`\n"));
+
+			if (tree->left)
+			{
+				DEBUG_print_syntax_tree(tree->left, depth + 1, path & ~(1ULL << depth));
+			}
+			if (tree->right)
+			{
+				DEBUG_print_syntax_tree(tree->right, depth + 1, path | (1ULL << depth));
+			}
+		}
+	}
+}
+#endif
+
+// @NOTE@ Not only for debugging: ledger output, sweeps and assertions print statements with it.
+internal void DEBUG_print_serialized_syntax_tree(SyntaxTree* tree)
+{
+	if (tree)
+	{
+		switch (tree->token.kind)
+		{
+			case TokenKind::number:
+			case TokenKind::identifier:
+			{
+				output_string(tree->token.string);
+			} break;
+
+			case TokenKind::plus:
+			{
+				DEBUG_print_serialized_syntax_tree(tree->left);
+				output_string(STRING_VIEW_OF(" + "));
+				DEBUG_print_serialized_syntax_tree(tree->right);
+			} break;
+
+			case TokenKind::minus:
+			{
+				if (tree->left)
+				{
+					DEBUG_print_serialized_syntax_tree(tree->left);
+					output_string(STRING_VIEW_OF(" - "));
+					DEBUG_print_serialized_syntax_tree(tree->right);
+				}
+				else
+				{
+					output_char('-');
+					DEBUG_print_serialized_syntax_tree(tree->right);
+				}
+			} break;
+
+			case TokenKind::asterisk:
+			{
+				if
+				(
+					tree->left ->token.kind == TokenKind::parenthetical_application || tree->left ->token.kind == TokenKind::inlined_application ||
+					tree->right->token.kind == TokenKind::parenthetical_application || tree->right->token.kind == TokenKind::inlined_application
+				)
+				{
+					DEBUG_print_serialized_syntax_tree(tree->left);
+					DEBUG_print_serialized_syntax_tree(tree->right);
+				}
+				else
+				{
+					DEBUG_print_serialized_syntax_tree(tree->left);
+					output_string(STRING_VIEW_OF(" * "));
+					DEBUG_print_serialized_syntax_tree(tree->right);
+				}
+			} break;
+
+			case TokenKind::forward_slash:
+			{
+				DEBUG_print_serialized_syntax_tree(tree->left);
+				output_char('/');
+				DEBUG_print_serialized_syntax_tree(tree->right);
+			} break;
+
+			case TokenKind::caret:
+			{
+				DEBUG_print_serialized_syntax_tree(tree->left);
+				output_char('^');
+				DEBUG_print_serialized_syntax_tree(tree->right);
+			} break;
+
+			case TokenKind::exclamation_point:
+			{
+				DEBUG_print_serialized_syntax_tree(tree->left);
+				output_char('!');
+			} break;
+
+			case TokenKind::parenthetical_application:
+			{
+				DEBUG_print_serialized_syntax_tree(tree->left);
+				output_char('(');
+				DEBUG_print_serialized_syntax_tree(tree->right);
+				output_char(')');
+			} break;
+
+			case TokenKind::inlined_application:
+			{
+				DEBUG_print_serialized_syntax_tree(tree->left);
+			} break;
+
+			case TokenKind::equal:
+			{
+				DEBUG_print_serialized_syntax_tree(tree->left);
+				output_string(STRING_VIEW_OF(" = "));
+				DEBUG_print_serialized_syntax_tree(tree->right);
+			} break;
+
+			case TokenKind::comma:
+			{
+				DEBUG_print_serialized_syntax_tree(tree->left);
+				output_string(STRING_VIEW_OF(", "));
+				DEBUG_print_serialized_syntax_tree(tree->right);
+			} break;
+
+			case TokenKind::colon:
+			{
+				DEBUG_print_serialized_syntax_tree(tree->left);
+				output_string(STRING_VIEW_OF(" : "));
+				DEBUG_print_serialized_syntax_tree(tree->right);
+			} break;
+
+			case TokenKind::array:
+			{
+				output_char('[');
+				DEBUG_print_serialized_syntax_tree(tree->right);
+				output_char(']');
+			} break;
+		}
+	}
+}
+
+#if DEBUG
+internal bool32 DEBUG_token_eq(Token a, Token b)
+{
+	return a.kind == b.kind && memcmp(a.string.data, b.string.data, a.string.size) == 0;
+}
+
+internal bool32 DEBUG_syntax_tree_eq(SyntaxTree* a, SyntaxTree* b)
+{
+	if (a == b)
+	{
+		return true;
+	}
+	else if (a && b)
+	{
+		return DEBUG_token_eq(a->token, b->token) && DEBUG_syntax_tree_eq(a->left, b->left) && DEBUG_syntax_tree_eq(a->right, b->right);
+	}
+	else
+	{
+		return false;
+	}
+}
+#endif
+
+//
+// Inlining.
+//
+
+// @NOTE@ Replaces calls to small, non-recursive ledger functions with a copy of the function body in which every parameter is the
+// argument subtree itself. The call is kept as the left child of an `inlined_application` node so that the ledger prints as written;
+// only the right child is evaluated. Arguments are shared rather than copied, so a parameter used twice evaluates its argument twice,
+// which is charged against the size threshold.
+
+global constexpr i32 INLINE_DEFAULT_THRESHOLD = 16;
+
+static_assert(ARRAY_CAPACITY(Ledger, statement_buffer) <= 64); // @NOTE@ Sets of statements are tracked in a `u64` mask.
+
+struct Inliner
+{
+	Ledger*    ledger;
+	Allocator* allocator;
+	i32        threshold;
+	i32        inlined_count_buffer[ARRAY_CAPACITY(Ledger, statement_buffer)];
+};
+
+internal Statement* find_called_function_declaration(Ledger* ledger, SyntaxTree* tree)
+{
+	if (tree->token.kind == TokenKind::parenthetical_application && tree->left && tree->left->token.kind == TokenKind::identifier)
+	{
+		return find_function_declaration(ledger, tree->left->token.string);
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+// @NOTE@ Only the evaluated side of an already inlined call is counted.
+internal i32 count_syntax_tree_nodes(SyntaxTree* tree)
+{
+	if (!tree)
+	{
+		return 0;
+	}
+	else if (tree->token.kind == TokenKind::inlined_application)
+	{
+		return count_syntax_tree_nodes(tree->right);
+	}
+	else
+	{
+		return 1 + count_syntax_tree_nodes(tree->left) + count_syntax_tree_nodes(tree->right);
+	}
+}
+
+internal i32 count_identifier_uses(SyntaxTree* tree, StringView name)
+{
+	if (tree)
+	{
+		return (tree->token.kind == TokenKind::identifier && tree->token.string == name) + count_identifier_uses(tree->left, name) + count_identifier_uses(tree->right, name);
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+internal bool32 does_syntax_tree_call(Ledger* ledger, SyntaxTree* tree, Statement* function, u64* visited_mask)
+{
+	if (!tree)
+	{
+		return false;
+	}
+
+	Statement* callee = find_called_function_declaration(ledger, tree);
+	if (callee)
+	{
+		if (callee == function)
+		{
+			return true;
+		}
+
+		u64 bit = 1ULL << (callee - ledger->statement_buffer);
+		if (!(*visited_mask & bit))
+		{
+			*visited_mask |= bit;
+			if (does_syntax_tree_call(ledger, callee->tree->right, function, visited_mask))
+			{
+				return true;
+			}
+		}
+	}
+
+	return does_syntax_tree_call(ledger, tree->left, function, visited_mask) || does_syntax_tree_call(ledger, tree->right, function, visited_mask);
+}
+
+// @NOTE@ Names in the body that are not the function's own parameters would be looked up in the caller once inlined, so they must not
+// be shadowed by the caller's parameters.
+internal bool32 is_capturing(SyntaxTree* tree, FunctionArgumentNode* parameters, FunctionArgumentNode* caller_parameters)
+{
+	if (!tree)
+	{
+		return false;
+	}
+
+	if (tree->token.kind == TokenKind::identifier)
+	{
+		FOR_NODES(parameters)
+		{
+			if (it->name == tree->token.string)
+			{
+				return false;
+			}
+		}
+
+		FOR_NODES(caller_parameters)
+		{
+			if (it->name == tree->token.string)
+			{
+				return true;
+			}
+		}
+	}
+
+	return is_capturing(tree->left, parameters, caller_parameters) || is_capturing(tree->right, parameters, caller_parameters);
+}
+
+internal SyntaxTree* substitute_syntax_tree(Allocator* allocator, SyntaxTree* tree, FunctionArgumentNode* parameters, SyntaxTree** argument_buffer)
+{
+	if (!tree)
+	{
+		return 0;
+	}
+
+	if (tree->token.kind == TokenKind::identifier)
+	{
+		FOR_NODES(parameters)
+		{
+			if (it->name == tree->token.string)
+			{
+				argument_buffer[it_index]->reference_count += 1;
+				return argument_buffer[it_index];
+			}
+		}
+	}
+
+	return init_single_syntax_tree(allocator, tree->token, substitute_syntax_tree(allocator, tree->left, parameters, argument_buffer), substitute_syntax_tree(allocator, tree->right, parameters, argument_buffer));
+}
+
+// @NOTE@ Returns the node that replaces `tree`; the call node itself is kept as the left child of the replacement.
+internal SyntaxTree* inline_syntax_tree(Inliner* inliner, SyntaxTree* tree, FunctionArgumentNode* caller_parameters)
+{
+	if (!tree || tree->token.kind == TokenKind::inlined_application)
+	{
+		return tree;
+	}
+
+	tree->left  = inline_syntax_tree(inliner, tree->left , caller_parameters);
+	tree->right = inline_syntax_tree(inliner, tree->right, caller_parameters);
+
+	Statement* function = find_called_function_declaration(inliner->ledger, tree);
+	if (!function)
+	{
+		return tree;
+	}
+
+	SyntaxTree* argument_buffer[ARRAY_CAPACITY(Ledger, statement_buffer)];
+	i32         argument_count = 0;
+	for (SyntaxTree* current_parameter_tree = tree->right; current_parameter_tree; current_parameter_tree = current_parameter_tree->right)
+	{
+		if (argument_count == ARRAY_CAPACITY(argument_buffer))
+		{
+			return tree;
+		}
+		else if (current_parameter_tree->token.kind == TokenKind::comma)
+		{
+			argument_buffer[argument_count] = current_parameter_tree->left;
+			argument_count += 1;
+		}
+		else
+		{
+			argument_buffer[argument_count] = current_parameter_tree;
+			argument_count += 1;
+			break;
+		}
+	}
+
+	i32 parameter_count = 0;
+	FOR_NODES(function->function_declaration.args)
+	{
+		parameter_count += 1;
+	}
+
+	if (parameter_count != argument_count) // @NOTE@ Left for the evaluator to complain about.
+	{
+		return tree;
+	}
+
+	i32 cost = count_syntax_tree_nodes(function->tree->right);
+	FOR_NODES(function->function_declaration.args)
+	{
+		cost += max(count_identifier_uses(function->tree->right, it->name) - 1, 0) * count_syntax_tree_nodes(argument_buffer[it_index]);
+	}
+
+	u64 visited_mask = 0;
+	if
+	(
+		cost > inliner->threshold ||
+		does_syntax_tree_call(inliner->ledger, function->tree->right, function, &visited_mask) ||
+		is_capturing(function->tree->right, function->function_declaration.args, caller_parameters)
+	)
+	{
+		return tree;
+	}
+
+	// @NOTE@ Calls within the body now live in the caller, so they are inlined against the caller's parameters.
+	SyntaxTree* body = substitute_syntax_tree(inliner->allocator, function->tree->right, function->function_declaration.args, argument_buffer);
+	body = inline_syntax_tree(inliner, body, caller_parameters);
+
+	Token inlined_application_token;
+	inlined_application_token.kind   = TokenKind::inlined_application;
+	inlined_application_token.string = STRING_VIEW_OF("inline");
+
+	inliner->inlined_count_buffer[function - inliner->ledger->statement_buffer] += 1;
+	return init_single_syntax_tree(inliner->allocator, inlined_application_token, tree, body);
+}
+
+internal void inline_ledger(Inliner* inliner, Ledger* ledger, Allocator* allocator, i32 threshold)
+{
+	*inliner = {};
+	inliner->ledger    = ledger;
+	inliner->allocator = allocator;
+	inliner->threshold = threshold;
+
+	FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+	{
+		switch (it->type)
+		{
+			case StatementType::expression:
+			{
+				it->tree = inline_syntax_tree(inliner, it->tree, 0);
+			} break;
+
+			case StatementType::variable_declaration:
+			{
+				it->tree->right = inline_syntax_tree(inliner, it->tree->right, 0);
+			} break;
+
+			case StatementType::function_declaration:
+			{
+				it->tree->right = inline_syntax_tree(inliner, it->tree->right, it->function_declaration.args);
+			} break;
+		}
+	}
+}
+
+//
+// Hash-consing.
+//
+
+// @NOTE@ Merges structurally identical subtrees across the whole ledger into shared nodes. A shared node that mentions no function
+// argument name evaluates to the same value wherever it appears, so it gets a memo slot and is computed once per evaluation.
+
+struct HashConsEntry
+{
+	SyntaxTree* tree;
+	u64         hash;
+	bool32      is_invariant;
+};
+
+struct HashConsTable
+{
+	Ledger*        ledger;
+	Allocator*     allocator;
+	i32            capacity;
+	HashConsEntry* entry_buffer;
+	i32            deduplicated_count;
+};
+
+struct HashConsReport
+{
+	i32 node_count;
+	i32 deduplicated_count;
+	i32 memoized_count;
+};
+
+internal bool32 is_function_argument_name(Ledger* ledger, StringView name)
+{
+	FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+	{
+		if (it->type == StatementType::function_declaration)
+		{
+			FOR_NODES(arg, it->function_declaration.args)
+			{
+				if (arg->name == name)
+				{
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+// @NOTE@ Calls of built-ins not annotated `PREDEFINED_PURE` are never memoized.
+internal bool32 is_impure_predefined_function(SyntaxTree* callee)
+{
+	if (callee->token.kind != TokenKind::identifier)
+	{
+		return false;
+	}
+
+	auto function = find_predefined_function(callee->token.string);
+	return function && !function->is_pure;
+}
+
+// @NOTE@ Returns the canonical node; a duplicate gives up its reference and is freed once nothing else holds it.
+internal SyntaxTree* hash_cons_syntax_tree(HashConsTable* table, SyntaxTree* tree, bool32* is_invariant)
+{
+	if (!tree)
+	{
+		*is_invariant = true;
+		return 0;
+	}
+
+	bool32 is_left_invariant;
+	bool32 is_right_invariant;
+	tree->left  = hash_cons_syntax_tree(table, tree->left , &is_left_invariant );
+	tree->right = hash_cons_syntax_tree(table, tree->right, &is_right_invariant);
+
+	u64 hash = hash_mix(static_cast<u64>(tree->token.kind), hash_bytes(tree->token.string));
+	hash = hash_mix(hash, reinterpret_cast<u64>(tree->left ));
+	hash = hash_mix(hash, reinterpret_cast<u64>(tree->right));
+
+	i32 index = static_cast<i32>(hash & (table->capacity - 1));
+	while
+	(
+		table->entry_buffer[index].tree &&
+		!(
+			table->entry_buffer[index].hash              == hash                &&
+			table->entry_buffer[index].tree->token.kind   == tree->token.kind   &&
+			table->entry_buffer[index].tree->token.string == tree->token.string &&
+			table->entry_buffer[index].tree->left         == tree->left         &&
+			table->entry_buffer[index].tree->right        == tree->right
+		)
+	)
+	{
+		index = (index + 1) & (table->capacity - 1);
+	}
+
+	aliasing entry = table->entry_buffer[index];
+	if (!entry.tree)
+	{
+		entry.tree         = tree;
+		entry.hash         = hash;
+		entry.is_invariant =
+			is_left_invariant && is_right_invariant &&
+			!(tree->token.kind == TokenKind::identifier && is_function_argument_name(table->ledger, tree->token.string)) &&
+			!(tree->token.kind == TokenKind::parenthetical_application && tree->left && is_impure_predefined_function(tree->left));
+	}
+	else if (entry.tree != tree)
+	{
+		entry.tree->reference_count += 1;
+		deinit_entire_syntax_tree(table->allocator, tree);
+		table->deduplicated_count += 1;
+	}
+
+	*is_invariant = entry.is_invariant;
+	return entry.tree;
+}
+
+internal void hash_cons_ledger(HashConsReport* report, Ledger* ledger, Allocator* allocator)
+{
+	memory_arena_checkpoint(&allocator->arena);
+
+	*report = {};
+	report->node_count = allocator->allocated_syntax_tree_count;
+
+	HashConsTable table = {};
+	table.ledger    = ledger;
+	table.allocator = allocator;
+	table.capacity  = 64;
+	while (table.capacity < allocator->allocated_syntax_tree_count * 2)
+	{
+		table.capacity *= 2;
+	}
+	table.entry_buffer = memory_arena_allocate_zero<HashConsEntry>(&allocator->arena, table.capacity);
+
+	FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+	{
+		bool32 is_invariant;
+		it->tree = hash_cons_syntax_tree(&table, it->tree, &is_invariant);
+	}
+
+	FOR_ELEMS(it, table.entry_buffer, table.capacity)
+	{
+		if (it->tree && it->tree->reference_count > 1 && it->is_invariant && it->tree->token.kind != TokenKind::number)
+		{
+			ledger->memo_count   += 1;
+			it->tree->memo_index  = ledger->memo_count;
+		}
+	}
+
+	report->deduplicated_count = table.deduplicated_count;
+	report->memoized_count     = ledger->memo_count;
+}
+
+// @NOTE@ Slot zero is unused so that a memo index of zero can mean "not memoized".
+internal void init_ledger_memo(Ledger* ledger, MemoryArena* arena)
+{
+	ledger->memo_epoch        = 1;
+	ledger->memo_value_buffer = memory_arena_allocate_zero<Value>(arena, ledger->memo_count + 1);
+	ledger->memo_epoch_buffer = memory_arena_allocate_zero<u32>(arena, ledger->memo_count + 1);
+}
+
+//
+// Value cache.
+//
+
+// @NOTE@ Declarations are keyed by a hash of their normalized tree in which every referenced declaration, user function and parameter
+// is replaced by its own hash. Declaration names, parameter names and grouping parentheses do not contribute, so editing a declaration
+// changes the key of exactly that declaration and of everything that depends on it.
+
+global constexpr u64 VALUE_CACHE_MAGIC           = 0x324C41565441454D; // "MEATVAL2"
+global constexpr u64 VALUE_CACHE_HASH_CALCULATING = 1;
+
+struct ValueCacheEntry
+{
+	u64    hash;
+	Number value;
+};
+
+struct ValueCacheFileHeader
+{
+	u64 magic;
+	i32 entry_count;
+	i32 number_size;     // @NOTE@ Caches are only read back by builds of the same precision.
+	u64 predefined_hash; // @NOTE@ Nor by builds with other built-ins, since a declaration's hash only covers the names it calls.
+};
+
+internal ValueCacheEntry* find_value_cache_entry(ValueCache* cache, u64 hash)
+{
+	i32 index = static_cast<i32>(hash & (cache->capacity - 1));
+	while (cache->entry_buffer[index].hash && cache->entry_buffer[index].hash != hash)
+	{
+		index = (index + 1) & (cache->capacity - 1);
+	}
+	return &cache->entry_buffer[index];
+}
+
+internal u64 hash_declaration(Statement* statement, Ledger* ledger);
+
+internal u64 hash_syntax_tree(SyntaxTree* tree, Ledger* ledger, FunctionArgumentNode* parameters)
+{
+	if (!tree)
+	{
+		return 0x5A5A5A5A5A5A5A5A;
+	}
+
+	switch (tree->token.kind)
+	{
+		case TokenKind::number:
+		{
+			// @NOTE@ An integer literal under `-exact` keys apart from the same literal as a number, so neither run is served the other's value.
+			u64 bits = 0;
+			memcpy(&bits, &tree->number, sizeof(tree->number));
+			u64 hash = hash_mix(static_cast<u64>(tree->token.kind), bits);
+			return is_integer_literal(tree, ledger) ? hash_mix(hash, ledger->is_exact) : hash;
+		} break;
+
+		case TokenKind::identifier:
+		{
+			FOR_NODES(parameters)
+			{
+				if (it->name == tree->token.string)
+				{
+					return hash_mix(static_cast<u64>(tree->token.kind), static_cast<u64>(it_index));
+				}
+			}
+
+			if (auto it = find_predefined_constant(tree->token.string))
+			{
+				u64 bits = 0;
+				memcpy(&bits, &it->value, sizeof(it->value));
+				return hash_mix(hash_bytes(it->name), bits);
+			}
+
+			// @NOTE@ A function is named without being called when it is given to a functional.
+			FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+			{
+				if
+				(
+					(it->type == StatementType::variable_declaration && it->tree->left->token.string       == tree->token.string) ||
+					(it->type == StatementType::function_declaration && it->tree->left->left->token.string == tree->token.string)
+				)
+				{
+					return hash_declaration(it, ledger);
+				}
+			}
+
+			return hash_mix(static_cast<u64>(tree->token.kind), hash_bytes(tree->token.string));
+		} break;
+
+		case TokenKind::inlined_application:
+		{
+			return hash_syntax_tree(tree->left, ledger, parameters);
+		} break;
+
+		case TokenKind::parenthetical_application:
+		{
+			if (!tree->left)
+			{
+				return hash_syntax_tree(tree->right, ledger, parameters);
+			}
+			else if (tree->left->token.kind == TokenKind::identifier)
+			{
+				FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+				{
+					if (it->type == StatementType::function_declaration && it->tree->left->left->token.string == tree->left->token.string)
+					{
+						return hash_mix(hash_mix(static_cast<u64>(tree->token.kind), hash_declaration(it, ledger)), hash_syntax_tree(tree->right, ledger, parameters));
+					}
+				}
+			}
+		} break;
+	}
+
+	return hash_mix(hash_mix(static_cast<u64>(tree->token.kind), hash_syntax_tree(tree->left, ledger, parameters)), hash_syntax_tree(tree->right, ledger, parameters));
+}
+
+// @NOTE@ Memoized in the statement. A declaration reached again while it is being hashed is a circular definition or a recursive
+// function; it then contributes only its name, which is enough to keep the key distinct.
+internal u64 hash_declaration(Statement* statement, Ledger* ledger)
+{
+	u64* hash;
+	switch (statement->type)
+	{
+		case StatementType::variable_declaration : hash = &statement->variable_declaration.hash; break;
+		case StatementType::function_declaration : hash = &statement->function_declaration.hash; break;
+		default                                  : ASSERT(false); return 0;
+	}
+
+	if (*hash == VALUE_CACHE_HASH_CALCULATING)
+	{
+		return hash_bytes(statement->tree->left->token.string);
+	}
+	else if (!*hash)
+	{
+		*hash = VALUE_CACHE_HASH_CALCULATING;
+
+		u64 result;
+		if (statement->type == StatementType::variable_declaration)
+		{
+			result = hash_syntax_tree(statement->tree->right, ledger, 0);
+		}
+		else
+		{
+			result = hash_mix(static_cast<u64>(statement->type), hash_syntax_tree(statement->tree->right, ledger, statement->function_declaration.args));
+		}
+
+		*hash = max(result, VALUE_CACHE_HASH_CALCULATING + 1);
+	}
+
+	return *hash;
+}
+
+// @NOTE@ A missing or malformed cache file is treated as empty.
+internal void init_value_cache(ValueCache* cache, Ledger* ledger, MemoryArena* arena, strlit file_path)
+{
+	*cache = {};
+
+	MappedFile file;
+	bool32     has_file = !init_mapped_file(&file, file_path);
+	DEFER
+	{
+		if (has_file)
+		{
+			deinit_mapped_file(&file);
+		}
+	};
+
+	ValueCacheFileHeader* header = has_file ? reinterpret_cast<ValueCacheFileHeader*>(file.data) : 0;
+	if
+	(
+		header &&
+		(
+			file.size               <  sizeof(ValueCacheFileHeader) ||
+			header->magic           != VALUE_CACHE_MAGIC            ||
+			header->number_size     != sizeof(Number)               ||
+			header->predefined_hash != PREDEFINED_HASH              ||
+			file.size != sizeof(ValueCacheFileHeader) + sizeof(ValueCacheEntry) * header->entry_count
+		)
+	)
+	{
+		header = 0;
+	}
+
+	cache->capacity = 64;
+	while (cache->capacity < ((header ? header->entry_count : 0) + ledger->statement_count) * 2)
+	{
+		cache->capacity *= 2;
+	}
+	cache->entry_buffer = memory_arena_allocate_zero<ValueCacheEntry>(arena, cache->capacity);
+
+	if (header)
+	{
+		FOR_ELEMS(it, reinterpret_cast<ValueCacheEntry*>(header + 1), header->entry_count)
+		{
+			*find_value_cache_entry(cache, it->hash) = *it;
+		}
+	}
+
+	FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+	{
+		if (it->type == StatementType::variable_declaration)
+		{
+			hash_declaration(it, ledger);
+		}
+	}
+
+	ledger->value_cache = cache;
+}
+
+// @NOTE@ Only the values of the current ledger are kept; entries of edited or deleted declarations are dropped.
+internal bool32 write_value_cache(strlit file_path, Ledger* ledger, MemoryArena* arena)
+{
+	memory_arena_checkpoint(arena);
+
+	ValueCacheFileHeader* header = memory_arena_allocate<ValueCacheFileHeader>(arena);
+	header->magic           = VALUE_CACHE_MAGIC;
+	header->number_size     = sizeof(Number);
+	header->predefined_hash = PREDEFINED_HASH;
+	header->entry_count     = 0;
+
+	FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+	{
+		if (it->type == StatementType::variable_declaration)
+		{
+			if (it->variable_declaration.status == VariableDeclarationStatus::cached)
+			{
+				if (is_number_value(it->variable_declaration.cached_evaluation)) // @NOTE@ Arrays and integers are recomputed every run.
+				{
+					ValueCacheEntry* entry = memory_arena_allocate_zero<ValueCacheEntry>(arena);
+					entry->hash  = it->variable_declaration.hash;
+					entry->value = unbox_number(it->variable_declaration.cached_evaluation);
+					header->entry_count += 1;
+				}
+			}
+			else if (find_value_cache_entry(ledger->value_cache, it->variable_declaration.hash)->hash) // @NOTE@ Skipped by a query.
+			{
+				ValueCacheEntry* entry = memory_arena_allocate_zero<ValueCacheEntry>(arena);
+				*entry = *find_value_cache_entry(ledger->value_cache, it->variable_declaration.hash);
+				header->entry_count += 1;
+			}
+		}
+	}
+
+	return write_entire_file(file_path, header, sizeof(ValueCacheFileHeader) + sizeof(ValueCacheEntry) * header->entry_count);
+}
+
+//
+// Integers.
+//
+
+// @NOTE@ Under `-exact`, integer literals evaluate to exact integers, and so do `+`, `-` and `*` of them, `^` with an exponent of at least
+// zero, `!` of an integer of at least zero, and `/` when it divides evenly. Otherwise the result is the number nearest to the exact one,
+// and anything else that meets an integer, such as a number, an array, a built-in or a functional, reads it as a number. Small integers
+// are computed in place; larger ones go through the limbs of `unified.h`, which take their scratch from the value arena. Products, powers
+// and factorials that would be longer than `INTEGER_MAX_LIMB_COUNT` limbs give numbers instead, which have long since overflowed.
+
+global constexpr i32 INTEGER_MAX_LIMB_COUNT    = 1 << 14; // @NOTE@ About 158,000 decimal digits.
+global constexpr i32 INTEGER_SMALL_DIGIT_COUNT = 13;      // @NOTE@ Literals of this many digits are always small.
+global constexpr i32 FACTORIAL_LEAF_SIZE       = 16;      // @NOTE@ Factors multiplied in one by one before products are taken by halves.
+global constexpr i64 FACTORIAL_MAX_EXACT_U64   = 20;      // @NOTE@ The largest integer whose factorial fits in a `u64`.
+
+internal ValueInteger* init_value_integer(Allocator* allocator, i32 limb_count)
+{
+	ValueInteger* integer = memory_arena_allocate<ValueInteger>(&allocator->value_arena);
+	integer->limb_count  = limb_count;
+	integer->is_negative = false;
+	integer->limbs       = memory_arena_allocate<u32>(&allocator->value_arena, limb_count);
+	return integer;
+}
+
+internal Value box_integer(Allocator* allocator, u64 magnitude, bool32 is_negative)
+{
+	if (magnitude < static_cast<u64>(INTEGER_SMALL_LIMIT))
+	{
+		return box_small_integer(is_negative ? -static_cast<i64>(magnitude) : static_cast<i64>(magnitude));
+	}
+
+	ValueInteger* integer = init_value_integer(allocator, 2);
+	integer->is_negative = is_negative;
+	integer->limbs[0]    = static_cast<u32>(magnitude);
+	integer->limbs[1]    = static_cast<u32>(magnitude >> 32);
+	return box_integer(integer);
+}
+
+// @NOTE@ Read from the digits rather than the parsed number, so that literals past the precision of `Number` stay exact.
+internal Value parse_integer(Allocator* allocator, StringView digits)
+{
+	if (digits.size <= INTEGER_SMALL_DIGIT_COUNT)
+	{
+		i64 integer = 0;
+		FOR_ELEMS(it, digits.data, digits.size)
+		{
+			integer = integer * 10 + (*it - '0');
+		}
+		return box_small_integer(integer);
+	}
+
+	ValueInteger* integer = init_value_integer(allocator, digits.size / DECIMAL_LIMB_DIGITS + 1);
+	integer->limb_count = parse_limbs(integer->limbs, digits);
+	return box_integer(integer);
+}
+
+internal Value add_integers(Allocator* allocator, Value left, Value right, bool32 is_subtraction)
+{
+	if (is_small_integer_value(left) && is_small_integer_value(right))
+	{
+		i64 sum = unbox_small_integer(left) + (is_subtraction ? -unbox_small_integer(right) : unbox_small_integer(right));
+		return box_integer(allocator, static_cast<u64>(sum < 0 ? -sum : sum), sum < 0);
+	}
+
+	u32          left_buffer [2];
+	u32          right_buffer[2];
+	ValueInteger a = get_value_integer(left , left_buffer );
+	ValueInteger b = get_value_integer(right, right_buffer);
+	b.is_negative = b.is_negative != is_subtraction;
+
+	if (compare_limbs(a.limbs, a.limb_count, b.limbs, b.limb_count) < 0)
+	{
+		ValueInteger larger = b;
+		b = a;
+		a = larger;
+	}
+
+	ValueInteger* result = init_value_integer(allocator, a.limb_count + 1);
+	result->is_negative = a.is_negative;
+	if (a.is_negative == b.is_negative)
+	{
+		result->limbs[a.limb_count] = add_limbs(result->limbs, a.limbs, a.limb_count, b.limbs, b.limb_count);
+	}
+	else
+	{
+		result->limbs[a.limb_count] = subtract_limbs(result->limbs, a.limbs, a.limb_count, b.limbs, b.limb_count);
+	}
+	return box_integer(result);
+}
+
+internal Value multiply_integers(Allocator* allocator, Value left, Value right)
+{
+	if (is_small_integer_value(left) && is_small_integer_value(right))
+	{
+		i64 x = unbox_small_integer(left);
+		i64 y = unbox_small_integer(right);
+		u64 x_magnitude = static_cast<u64>(x < 0 ? -x : x);
+		u64 y_magnitude = static_cast<u64>(y < 0 ? -y : y);
+		if (x_magnitude <= 0xFFFFFFFF && y_magnitude <= 0xFFFFFFFF)
+		{
+			return box_integer(allocator, x_magnitude * y_magnitude, (x < 0) != (y < 0));
+		}
+	}
+
+	u32          left_buffer [2];
+	u32          right_buffer[2];
+	ValueInteger a = get_value_integer(left , left_buffer );
+	ValueInteger b = get_value_integer(right, right_buffer);
+
+	if (a.limb_count + b.limb_count > INTEGER_MAX_LIMB_COUNT)
+	{
+		return box_number(static_cast<Number>(get_integer_f64(a) * get_integer_f64(b)));
+	}
+
+	ValueInteger* result = init_value_integer(allocator, a.limb_count + b.limb_count);
+	result->is_negative = a.is_negative != b.is_negative;
+	multiply_limbs(result->limbs, a.limbs, a.limb_count, b.limbs, b.limb_count, &allocator->value_arena);
+	return box_integer(result);
+}
+
+// @NOTE@ A remainder makes the result a number: the quotient plus the remainder over the divisor, the latter two scaled first so that
+// neither overflows on its own.
+internal Value divide_integers(Allocator* allocator, Value left, Value right)
+{
+	if (is_small_integer_value(left) && is_small_integer_value(right))
+	{
+		i64 x = unbox_small_integer(left);
+		i64 y = unbox_small_integer(right);
+		if (y && x % y == 0)
+		{
+			return box_small_integer(x / y);
+		}
+		return box_number(static_cast<Number>(static_cast<f64>(x) / static_cast<f64>(y)));
+	}
+
+	u32          left_buffer [2];
+	u32          right_buffer[2];
+	ValueInteger a = get_value_integer(left , left_buffer );
+	ValueInteger b = get_value_integer(right, right_buffer);
+
+	if (!b.limb_count)
+	{
+		return box_number(static_cast<Number>(get_integer_f64(a) / 0.0));
+	}
+
+	ValueInteger* quotient  = init_value_integer(allocator, a.limb_count >= b.limb_count ? a.limb_count - b.limb_count + 1 : 0);
+	ValueInteger  remainder = a;
+	if (a.limb_count >= b.limb_count)
+	{
+		remainder.limbs = memory_arena_allocate<u32>(&allocator->value_arena, b.limb_count);
+		divide_limbs(quotient->limbs, remainder.limbs, a.limbs, a.limb_count, b.limbs, b.limb_count, &allocator->value_arena);
+		remainder.limb_count = trim_limbs(remainder.limbs, b.limb_count);
+	}
+	quotient->is_negative = a.is_negative != b.is_negative;
+
+	if (!remainder.limb_count)
+	{
+		return box_integer(quotient);
+	}
+
+	quotient->limb_count = trim_limbs(quotient->limbs, quotient->limb_count);
+	i32 remainder_exponent;
+	i32 divisor_exponent;
+	f64 remainder_scaled = get_integer_scaled(remainder, &remainder_exponent);
+	f64 divisor_scaled   = get_integer_scaled(b, &divisor_exponent);
+	return box_number(static_cast<Number>(get_integer_f64(*quotient) + ldexp(remainder_scaled / divisor_scaled, remainder_exponent - divisor_exponent)));
+}
+
+// @NOTE@ By squaring, from the top bit of the exponent down, in two buffers long enough for the result. Negative exponents give numbers.
+internal Value exponentiate_integers(Allocator* allocator, Value left, Value right)
+{
+	u32          left_buffer [2];
+	u32          right_buffer[2];
+	ValueInteger base     = get_value_integer(left , left_buffer );
+	ValueInteger exponent = get_value_integer(right, right_buffer);
+	bool32       is_odd   = exponent.limb_count && (exponent.limbs[0] & 1);
+
+	if (base.limb_count == 1 && base.limbs[0] == 1)
+	{
+		return box_small_integer(base.is_negative && is_odd ? -1 : 1);
+	}
+
+	i32 base_bit_count = base.limb_count ? 32 * base.limb_count - count_leading_zeros(base.limbs[base.limb_count - 1]) : 0;
+	if (exponent.is_negative || exponent.limb_count > 1 || (exponent.limb_count && static_cast<u64>(base_bit_count) * exponent.limbs[0] / 32 >= INTEGER_MAX_LIMB_COUNT))
+	{
+		return box_number(static_cast<Number>(pow(get_integer_f64(base), get_integer_f64(exponent))));
+	}
+
+	u32 power    = exponent.limb_count ? exponent.limbs[0] : 0;
+	i32 capacity = static_cast<i32>(static_cast<u64>(base_bit_count) * power / 32) + 2;
+	u32* result  = memory_arena_allocate<u32>(&allocator->value_arena, capacity);
+	u32* product = memory_arena_allocate<u32>(&allocator->value_arena, capacity);
+	i32  count   = 1;
+	result[0] = 1;
+
+	FOR_RANGE_REV(bit, 32 - count_leading_zeros(power))
+	{
+		multiply_limbs(product, result, count, result, count, &allocator->value_arena);
+		count = trim_limbs(product, 2 * count);
+
+		if ((power >> bit) & 1)
+		{
+			multiply_limbs(result, product, count, base.limbs, base.limb_count, &allocator->value_arena);
+			count = trim_limbs(result, count + base.limb_count);
+		}
+		else
+		{
+			u32* swap = result;
+			result  = product;
+			product = swap;
+		}
+	}
+
+	ValueInteger* integer = memory_arena_allocate<ValueInteger>(&allocator->value_arena);
+	integer->limb_count  = count;
+	integer->is_negative = base.is_negative && is_odd;
+	integer->limbs       = result;
+	return box_integer(integer);
+}
+
+internal Value negate_integer(Allocator* allocator, Value operand)
+{
+	if (is_small_integer_value(operand))
+	{
+		return box_small_integer(-unbox_small_integer(operand));
+	}
+
+	// @NOTE@ The limbs are shared, since a value never changes once made.
+	u32           limb_buffer[2];
+	ValueInteger* negation = memory_arena_allocate<ValueInteger>(&allocator->value_arena);
+	*negation = get_value_integer(operand, limb_buffer);
+	negation->is_negative = !negation->is_negative;
+	return box_integer(negation);
+}
+
+// @NOTE@ The product of the integers from `first` to `last`, taken by halves so that the big multiplications are of operands of about the
+// same length, which is where Karatsuba pays.
+internal ValueInteger* multiply_integer_range(Allocator* allocator, u32 first, u32 last)
+{
+	if (last - first < FACTORIAL_LEAF_SIZE)
+	{
+		ValueInteger* product = init_value_integer(allocator, last - first + 2);
+		product->limbs[0]   = 1;
+		product->limb_count = 1;
+		for (u32 factor = first; factor <= last; factor += 1)
+		{
+			u32 carry = multiply_limbs_by_limb(product->limbs, product->limbs, product->limb_count, factor, 0);
+			if (carry)
+			{
+				product->limbs[product->limb_count]  = carry;
+				product->limb_count                 += 1;
+			}
+		}
+		return product;
+	}
+
+	u32           middle  = first + (last - first) / 2;
+	ValueInteger* low     = multiply_integer_range(allocator, first, middle);
+	ValueInteger* high    = multiply_integer_range(allocator, middle + 1, last);
+	ValueInteger* product = init_value_integer(allocator, low->limb_count + high->limb_count);
+	multiply_limbs(product->limbs, low->limbs, low->limb_count, high->limbs, high->limb_count, &allocator->value_arena);
+	product->limb_count = trim_limbs(product->limbs, product->limb_count);
+	return product;
+}
+
+// @NOTE@ Negative integers give what `tgamma` does at its poles.
+internal Value factorial_integer(Allocator* allocator, Value operand)
+{
+	u32          limb_buffer[2];
+	ValueInteger integer = get_value_integer(operand, limb_buffer);
+	f64          number  = get_integer_f64(integer);
+
+	if (integer.is_negative || integer.limb_count > 1 || lgamma(number + 1) / log(2.0) / 32 >= INTEGER_MAX_LIMB_COUNT)
+	{
+		return box_number(static_cast<Number>(tgamma(number + 1)));
+	}
+
+	u32 n = integer.limb_count ? integer.limbs[0] : 0;
+	if (n <= FACTORIAL_MAX_EXACT_U64)
+	{
+		u64 product = 1;
+		FOR_RANGE(factor, 2, static_cast<i32>(n) + 1)
+		{
+			product *= static_cast<u64>(factor);
+		}
+		return box_integer(allocator, product, false);
+	}
+
+	return box_integer(multiply_integer_range(allocator, 2, n));
+}
+
+//
+// Arrays.
+//
+
+// @NOTE@ Operators and built-ins apply element-wise, and a number is broadcast against every element of an array. Arrays in the same
+// operation must have the same length. Every operation is one loop over the whole array: `+`, `-`, `*` and `/` are written with SSE, and
+// `^`, `!` and the built-ins call the C runtime per element, which the compiler vectorizes wherever it has a vector version of the function.
+// `^` and `!` take integer operands without the C runtime.
+// Operators on two numbers are done inline; any other pairing of types is looked up in a table indexed by the type of each operand.
+
+global constexpr i32 VALUE_TYPE_COUNT = static_cast<i32>(ValueType::integer) + 1;
+
+global constexpr StringView EVALUATION_ERROR_ARRAY_LENGTHS = STRING_VIEW_OF("Arrays of different lengths can't be combined.");
+global constexpr StringView EVALUATION_ERROR_RANGE_STEP    = STRING_VIEW_OF("A range must have finite bounds and a step that isn't zero.");
+global constexpr StringView EVALUATION_ERROR_RANGE_SPAN    = STRING_VIEW_OF("A range can't step away from its last element.");
+global constexpr StringView EVALUATION_ERROR_ARRAY_MEMORY  = STRING_VIEW_OF("An array doesn't fit in the memory set aside for values.");
+
+internal Value report_evaluation_error(Allocator* allocator, const StringView* error)
+{
+	if (!allocator->evaluation_error)
+	{
+		allocator->evaluation_error = error;
+	}
+	return box_number(NAN);
+}
+
+// @NOTE@ Returns null, with the error reported, when the array doesn't fit in the value arena.
+internal ValueArray* init_value_array(Allocator* allocator, i32 count)
+{
+	ASSERT(count > 0);
+
+	if (allocator->value_arena.used + sizeof(ValueArray) + sizeof(Element) * count > allocator->value_arena.size)
+	{
+		report_evaluation_error(allocator, &EVALUATION_ERROR_ARRAY_MEMORY);
+		return 0;
+	}
+
+	ValueArray* array = memory_arena_allocate<ValueArray>(&allocator->value_arena);
+	array->count    = count;
+	array->elements = memory_arena_allocate<Element>(&allocator->value_arena, count);
+	return array;
+}
+
+internal Dual* init_value_dual(Allocator* allocator, Number value, Number derivative)
+{
+	Dual* dual = memory_arena_allocate<Dual>(&allocator->value_arena);
+	dual->value      = value;
+	dual->derivative = derivative;
+	return dual;
+}
+
+// @NOTE@ An SSE register holds four `f32` elements or two `f64` ones.
+template <typename ELEMENT>
+struct ElementVector;
+
+template <>
+struct ElementVector<f32>
+{
+	typedef __m128 Type;
+	static constexpr i32 WIDTH = 4;
+	static Type load (const f32* data)         { return _mm_loadu_ps(data); }
+	static void store(f32*       data, Type v) { _mm_storeu_ps(data, v);    }
+};
+
+template <>
+struct ElementVector<f64>
+{
+	typedef __m128d Type;
+	static constexpr i32 WIDTH = 2;
+	static Type load (const f64* data)         { return _mm_loadu_pd(data); }
+	static void store(f64*       data, Type v) { _mm_storeu_pd(data, v);    }
+};
+
+internal f32 power(f32 base, f32 exponent) { return powf(base, exponent); }
+internal f64 power(f64 base, f64 exponent) { return pow (base, exponent); }
+
+internal Dual power(Dual base, Dual exponent)
+{
+	Number value      = power(base.value, exponent.value);
+	Number derivative = exponent.value * power(base.value, exponent.value - 1) * base.derivative;
+	if (exponent.derivative != 0) // @NOTE@ Otherwise the logarithm of a negative base would make it NaN for nothing.
+	{
+		derivative += value * log(base.value) * exponent.derivative;
+	}
+	return { value, derivative };
+}
+
+// @NOTE@ Integer exponents are common enough, as in `x^2` and `x^3`, that they skip `pow` and are raised by squaring in `f64`. That is
+// exact for integer bases as long as the power fits in the 53 bits of an `f64`, and otherwise off by no more than a few roundings, which
+// `f32` results round away. An `f64` result that isn't exact goes through `pow`, which rounds once.
+global constexpr i32 SQUARING_MAX_EXPONENT = 64;
+global constexpr f64 SQUARING_MAX_EXACT    = 9007199254740992.0; // 2^53
+
+internal f64 power_by_squaring(f64 base, u32 exponent)
+{
+	f64 result = 1;
+	while (exponent)
+	{
+		if (exponent & 1)
+		{
+			result *= base;
+		}
+		base     *= base;
+		exponent >>= 1;
+	}
+	return result;
+}
+
+// @NOTE@ Factorials of the integers whose factorial fits in a `u64`, so that `n!` of them is exact rather than whatever `tgamma` rounds
+// to. Larger factorials still go through `tgamma`.
+global constexpr u64 EXACT_FACTORIALS[] =
+	{
+		1, 1, 2, 6, 24, 120, 720, 5040, 40320, 362880, 3628800, 39916800, 479001600, 6227020800, 87178291200, 1307674368000, 20922789888000,
+		355687428096000, 6402373705728000, 121645100408832000, 2432902008176640000,
+	};
+
+// @NOTE@ The derivative of the logarithm of the gamma function, for factorials of dual numbers. The argument is stepped up by the
+// recurrence until the asymptotic series is accurate.
+internal f64 digamma(f64 x)
+{
+	f64 result = 0;
+	while (x < 6)
+	{
+		result -= 1 / x;
+		x      += 1;
+	}
+
+	f64 r = 1 / (x * x);
+	return result + log(x) - 0.5 / x - r * (1.0 / 12 - r * (1.0 / 120 - r * (1.0 / 252 - r * (1.0 / 240 - r / 132))));
+}
+
+// @NOTE@ `scalar` is instantiated for both `Number` and `Element`, and `vector` is overloaded for the register of either element type.
+
+struct ArrayAddition
+{
+	static constexpr bool32 HAS_VECTOR = true;
+	static __m128  vector(__m128  a, __m128  b) { return _mm_add_ps(a, b); }
+	static __m128d vector(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+	template <typename SCALAR> static SCALAR scalar(SCALAR a, SCALAR b) { return a + b; }
+	static Value integer(Allocator* allocator, Value a, Value b) { return add_integers(allocator, a, b, false); }
+};
+
+struct ArraySubtraction
+{
+	static constexpr bool32 HAS_VECTOR = true;
+	static __m128  vector(__m128  a, __m128  b) { return _mm_sub_ps(a, b); }
+	static __m128d vector(__m128d a, __m128d b) { return _mm_sub_pd(a, b); }
+	template <typename SCALAR> static SCALAR scalar(SCALAR a, SCALAR b) { return a - b; }
+	static Value integer(Allocator* allocator, Value a, Value b) { return add_integers(allocator, a, b, true); }
+};
+
+struct ArrayMultiplication
+{
+	static constexpr bool32 HAS_VECTOR = true;
+	static __m128  vector(__m128  a, __m128  b) { return _mm_mul_ps(a, b); }
+	static __m128d vector(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+	template <typename SCALAR> static SCALAR scalar(SCALAR a, SCALAR b) { return a * b; }
+	static Value integer(Allocator* allocator, Value a, Value b) { return multiply_integers(allocator, a, b); }
+};
+
+struct ArrayDivision
+{
+	static constexpr bool32 HAS_VECTOR = true;
+	static __m128  vector(__m128  a, __m128  b) { return _mm_div_ps(a, b); }
+	static __m128d vector(__m128d a, __m128d b) { return _mm_div_pd(a, b); }
+	template <typename SCALAR> static SCALAR scalar(SCALAR a, SCALAR b) { return a / b; }
+	static Value integer(Allocator* allocator, Value a, Value b) { return divide_integers(allocator, a, b); }
+};
+
+struct ArrayExponentiation
+{
+	static constexpr bool32 HAS_VECTOR = false;
+	template <typename SCALAR> static SCALAR scalar(SCALAR a, SCALAR b)
+	{
+		if (b == floor(b) && fabs(b) <= SQUARING_MAX_EXPONENT)
+		{
+			f64 result = power_by_squaring(a, static_cast<u32>(fabs(b)));
+			if (sizeof(SCALAR) == sizeof(f32) || (a == floor(a) && fabs(result) <= SQUARING_MAX_EXACT))
+			{
+				return static_cast<SCALAR>(b < 0 ? 1 / result : result);
+			}
+		}
+
+		return power(a, b);
+	}
+
+	static Dual  scalar (Dual a, Dual b)                          { return power(a, b); }
+	static Value integer(Allocator* allocator, Value a, Value b) { return exponentiate_integers(allocator, a, b); }
+};
+
+struct ArrayNegation
+{
+	static constexpr bool32 HAS_VECTOR = true;
+	static __m128  vector(__m128  a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+	static __m128d vector(__m128d a) { return _mm_xor_pd(a, _mm_set1_pd(-0.0));  }
+	template <typename SCALAR> static SCALAR scalar(SCALAR a) { return -a; }
+	static Value integer(Allocator* allocator, Value a) { return negate_integer(allocator, a); }
+};
+
+struct ArrayFactorial
+{
+	static constexpr bool32 HAS_VECTOR = false;
+	template <typename SCALAR> static SCALAR scalar(SCALAR a)
+	{
+		if (a >= 0 && a < ARRAY_CAPACITY(EXACT_FACTORIALS) && a == floor(a))
+		{
+			return static_cast<SCALAR>(EXACT_FACTORIALS[static_cast<i32>(a)]);
+		}
+
+		return static_cast<SCALAR>(tgamma(static_cast<f64>(a) + 1.0));
+	}
+
+	static Dual scalar(Dual a)
+	{
+		Number value = scalar(a.value);
+		return { value, value * static_cast<Number>(digamma(static_cast<f64>(a.value) + 1.0)) * a.derivative };
+	}
+
+	static Value integer(Allocator* allocator, Value a) { return factorial_integer(allocator, a); }
+};
+
+typedef Value BinaryOperatorHandler(Allocator* allocator, Value left, Value right);
+typedef Value UnaryOperatorHandler (Allocator* allocator, Value operand);
+
+template <typename OPERATION>
+internal Value apply_number_binary_operator(Allocator*, Value left, Value right)
+{
+	return box_number(OPERATION::scalar(unbox_number(left), unbox_number(right)));
+}
+
+template <typename OPERATION>
+internal Value apply_number_unary_operator(Allocator*, Value operand)
+{
+	return box_number(OPERATION::scalar(unbox_number(operand)));
+}
+
+// @NOTE@ A number or an integer is read as an array whose elements are all that number by stepping over its lanes zero elements at a time.
+template <typename OPERATION>
+internal Value apply_array_binary_operator(Allocator* allocator, Value left, Value right)
+{
+	typedef ElementVector<Element> Vector;
+
+	// @NOTE@ The lanes of an array are never read.
+	Element        left_number    = static_cast<Element>(get_value_number(left));
+	Element        right_number   = static_cast<Element>(get_value_number(right));
+	Element        left_lanes [4] = { left_number , left_number , left_number , left_number  };
+	Element        right_lanes[4] = { right_number, right_number, right_number, right_number };
+	const Element* left_elements  = left_lanes;
+	const Element* right_elements = right_lanes;
+	i32            left_step      = 0;
+	i32            right_step     = 0;
+	i32            count          = 0;
+
+	if (get_value_type(left) == ValueType::array)
+	{
+		left_elements = unbox_array(left)->elements;
+		left_step     = 1;
+		count         = unbox_array(left)->count;
+	}
+
+	if (get_value_type(right) == ValueType::array)
+	{
+		if (count && count != unbox_array(right)->count)
+		{
+			return report_evaluation_error(allocator, &EVALUATION_ERROR_ARRAY_LENGTHS);
+		}
+		right_elements = unbox_array(right)->elements;
+		right_step     = 1;
+		count          = unbox_array(right)->count;
+	}
+
+	ValueArray* result = init_value_array(allocator, count);
+	if (!result)
+	{
+		return box_number(NAN);
+	}
+
+	i32 i = 0;
+	if constexpr (OPERATION::HAS_VECTOR)
+	{
+		for (; i + Vector::WIDTH <= result->count; i += Vector::WIDTH)
+		{
+			Vector::store(result->elements + i, OPERATION::vector(Vector::load(left_elements + i * left_step), Vector::load(right_elements + i * right_step)));
+		}
+	}
+	for (; i < result->count; i += 1)
+	{
+		result->elements[i] = OPERATION::scalar(left_elements[i * left_step], right_elements[i * right_step]);
+	}
+
+	return box_array(result);
+}
+
+// @NOTE@ Numbers are promoted to dual numbers with no derivative. Dual numbers and arrays don't mix.
+template <typename OPERATION>
+internal Value apply_dual_binary_operator(Allocator* allocator, Value left, Value right)
+{
+	Dual result = OPERATION::scalar(get_value_dual(left), get_value_dual(right));
+	return box_dual(init_value_dual(allocator, result.value, result.derivative));
+}
+
+template <typename OPERATION>
+internal Value apply_dual_unary_operator(Allocator* allocator, Value operand)
+{
+	Dual result = OPERATION::scalar(*unbox_dual(operand));
+	return box_dual(init_value_dual(allocator, result.value, result.derivative));
+}
+
+// @NOTE@ Two integers stay exact wherever the operation allows; an integer with a number is read as a number.
+template <typename OPERATION>
+internal Value apply_integer_binary_operator(Allocator* allocator, Value left, Value right)
+{
+	if (is_number_value(left) || is_number_value(right))
+	{
+		return box_number(OPERATION::scalar(get_value_number(left), get_value_number(right)));
+	}
+
+	return OPERATION::integer(allocator, left, right);
+}
+
+template <typename OPERATION>
+internal Value apply_integer_unary_operator(Allocator* allocator, Value operand)
+{
+	return OPERATION::integer(allocator, operand);
+}
+
+template <typename OPERATION>
+internal Value apply_array_unary_operator(Allocator* allocator, Value operand)
+{
+	typedef ElementVector<Element> Vector;
+
+	ValueArray* array  = unbox_array(operand);
+	ValueArray* result = init_value_array(allocator, array->count);
+	if (!result)
+	{
+		return box_number(NAN);
+	}
+
+	i32 i = 0;
+	if constexpr (OPERATION::HAS_VECTOR)
+	{
+		for (; i + Vector::WIDTH <= result->count; i += Vector::WIDTH)
+		{
+			Vector::store(result->elements + i, OPERATION::vector(Vector::load(array->elements + i)));
+		}
+	}
+	for (; i < result->count; i += 1)
+	{
+		result->elements[i] = OPERATION::scalar(array->elements[i]);
+	}
+
+	return box_array(result);
+}
+
+// @NOTE@ Indexed by the `ValueType` of the left operand, then of the right.
+template <typename OPERATION>
+global constexpr BinaryOperatorHandler* BINARY_OPERATOR_HANDLERS[VALUE_TYPE_COUNT][VALUE_TYPE_COUNT] =
+	{
+		{ apply_number_binary_operator <OPERATION>, apply_array_binary_operator<OPERATION>, apply_dual_binary_operator<OPERATION>, apply_integer_binary_operator<OPERATION> },
+		{ apply_array_binary_operator  <OPERATION>, apply_array_binary_operator<OPERATION>, apply_dual_binary_operator<OPERATION>, apply_array_binary_operator  <OPERATION> },
+		{ apply_dual_binary_operator   <OPERATION>, apply_dual_binary_operator <OPERATION>, apply_dual_binary_operator<OPERATION>, apply_dual_binary_operator   <OPERATION> },
+		{ apply_integer_binary_operator<OPERATION>, apply_array_binary_operator<OPERATION>, apply_dual_binary_operator<OPERATION>, apply_integer_binary_operator<OPERATION> }
+	};
+
+template <typename OPERATION>
+global constexpr UnaryOperatorHandler* UNARY_OPERATOR_HANDLERS[VALUE_TYPE_COUNT] =
+	{
+		apply_number_unary_operator <OPERATION>,
+		apply_array_unary_operator  <OPERATION>,
+		apply_dual_unary_operator   <OPERATION>,
+		apply_integer_unary_operator<OPERATION>
+	};
+
+template <typename OPERATION>
+internal Value apply_binary_operator(Allocator* allocator, Value left, Value right)
+{
+	if (is_number_value(left) && is_number_value(right))
+	{
+		return box_number(OPERATION::scalar(unbox_number(left), unbox_number(right)));
+	}
+
+	return BINARY_OPERATOR_HANDLERS<OPERATION>[static_cast<i32>(get_value_type(left))][static_cast<i32>(get_value_type(right))](allocator, left, right);
+}
+
+template <typename OPERATION>
+internal Value apply_unary_operator(Allocator* allocator, Value operand)
+{
+	if (is_number_value(operand))
+	{
+		return box_number(OPERATION::scalar(unbox_number(operand)));
+	}
+
+	return UNARY_OPERATOR_HANDLERS<OPERATION>[static_cast<i32>(get_value_type(operand))](allocator, operand);
+}
+
+// @NOTE@ Numbers among the arguments of an array kernel are spread into arrays first, so that the kernel only reads contiguous elements.
+// Built-ins without a kernel are called once per element instead. Any dual number among the arguments makes them all dual. Integers are
+// read as numbers.
+internal Value apply_predefined_function(decltype(+PREDEFINED_FUNCTIONS) function, FunctionArgumentNode* arguments, Allocator* allocator)
+{
+	i32    count   = 0;
+	bool32 is_dual = false;
+	FOR_NODES(arguments)
+	{
+		if (get_value_type(it->value) == ValueType::integer)
+		{
+			it->value = box_number(get_value_number(it->value));
+		}
+		else if (get_value_type(it->value) == ValueType::dual)
+		{
+			is_dual = true;
+		}
+		else if (!is_number_value(it->value))
+		{
+			if (count && count != unbox_array(it->value)->count)
+			{
+				return report_evaluation_error(allocator, &EVALUATION_ERROR_ARRAY_LENGTHS);
+			}
+			count = unbox_array(it->value)->count;
+		}
+	}
+
+	if (is_dual)
+	{
+		Dual* dual_buffer = memory_arena_allocate<Dual>(&allocator->value_arena, function->arity);
+		FOR_NODES(arguments)
+		{
+			dual_buffer[it_index] = get_value_dual(it->value);
+		}
+
+		Dual result = function->dual_function(dual_buffer);
+		return box_dual(init_value_dual(allocator, result.value, result.derivative));
+	}
+	else if (!count)
+	{
+		return function->function(arguments);
+	}
+
+	ValueArray* result = init_value_array(allocator, count);
+	if (!result)
+	{
+		return box_number(NAN);
+	}
+	else if (function->array_function)
+	{
+		Element** argument_elements = memory_arena_allocate<Element*>(&allocator->value_arena, function->arity);
+		FOR_NODES(arguments)
+		{
+			if (is_number_value(it->value))
+			{
+				ValueArray* spread = init_value_array(allocator, count);
+				if (!spread)
+				{
+					return box_number(NAN);
+				}
+
+				FOR_RANGE(i, count)
+				{
+					spread->elements[i] = static_cast<Element>(unbox_number(it->value));
+				}
+				argument_elements[it_index] = spread->elements;
+			}
+			else
+			{
+				argument_elements[it_index] = unbox_array(it->value)->elements;
+			}
+		}
+
+		function->array_function(result->elements, count, argument_elements);
+	}
+	else
+	{
+		Value* array_buffer = memory_arena_allocate<Value>(&allocator->value_arena, function->arity);
+		FOR_NODES(arguments)
+		{
+			array_buffer[it_index] = it->value;
+		}
+
+		FOR_RANGE(i, count)
+		{
+			FOR_NODES(arguments)
+			{
+				if (!is_number_value(array_buffer[it_index]))
+				{
+					it->value = box_number(unbox_array(array_buffer[it_index])->elements[i]);
+				}
+			}
+			result->elements[i] = static_cast<Element>(unbox_number(function->function(arguments)));
+		}
+	}
+
+	return box_array(result);
+}
+
+// @NOTE@ `[first : last]` counts up by one and `[first : last : step]` by `step`. Both include `last` when the steps land on it, with
+// some slack so that a step like 0.1 is not cut short by rounding.
+internal Value evaluate_array_range(Allocator* allocator, Number first, Number last, Number step)
+{
+	if (!isfinite(first) || !isfinite(last) || !isfinite(step) || step == 0)
+	{
+		return report_evaluation_error(allocator, &EVALUATION_ERROR_RANGE_STEP);
+	}
+
+	Number span = (last - first) / step;
+	if (!(span >= 0))
+	{
+		return report_evaluation_error(allocator, &EVALUATION_ERROR_RANGE_SPAN);
+	}
+
+	// @NOTE@ Checked before the count is narrowed, so a span too large for an `i32` is reported rather than wrapped.
+	Number count = floor(span + static_cast<Number>(0.0001)) + 1;
+	if (count > static_cast<Number>(allocator->value_arena.size / sizeof(Element)))
+	{
+		return report_evaluation_error(allocator, &EVALUATION_ERROR_ARRAY_MEMORY);
+	}
+
+	ValueArray* result = init_value_array(allocator, static_cast<i32>(count));
+	if (!result)
+	{
+		return box_number(NAN);
+	}
+
+	FOR_RANGE(i, result->count)
+	{
+		result->elements[i] = static_cast<Element>(first + static_cast<Number>(i) * step);
+	}
+	return box_array(result);
+}
+
+internal Number evaluate_functional(FunctionalType type, Statement* function, Number* argument_buffer, Ledger* ledger, Allocator* allocator);
+
+internal void evaluate_statement(Statement* statement, Ledger* ledger, Allocator* allocator, FunctionArgumentNode* binded_args = 0);
+
+internal Value evaluate_tree(SyntaxTree* tree, Ledger* ledger, Allocator* allocator, FunctionArgumentNode* binded_args = 0)
+{
+	if (tree->memo_index && ledger->memo_epoch_buffer[tree->memo_index] == ledger->memo_epoch)
+	{
+		return ledger->memo_value_buffer[tree->memo_index];
+	}
+
+	Statement exp = {};
+	exp.tree = tree;
+	exp.type = StatementType::expression;
+	evaluate_statement(&exp, ledger, allocator, binded_args);
+	ASSERT(exp.expression.is_cached);
+
+	if (tree->memo_index)
+	{
+		ledger->memo_value_buffer[tree->memo_index] = exp.expression.cached_evaluation;
+		ledger->memo_epoch_buffer[tree->memo_index] = ledger->memo_epoch;
+	}
+
+	return exp.expression.cached_evaluation;
+}
+
+internal void evaluate_statement(Statement* statement, Ledger* ledger, Allocator* allocator, FunctionArgumentNode* binded_args)
+{
+	lambda evaluate_expression = [&](SyntaxTree* tree) { return evaluate_tree(tree, ledger, allocator, binded_args); };
+
+	switch (statement->type)
+	{
+		case StatementType::assertion:
+		{
+			evaluate_statement(statement->assertion.corresponding_statement, ledger, allocator);
+			if (allocator->evaluation_error) // @NOTE@ Left for the caller to report; the value checked would only be NaN.
+			{
+				break;
+			}
+
+			Number expectant_value = statement->tree->right->number;
+			Number resultant_value = NAN;
+
+			switch (statement->assertion.corresponding_statement->type)
+			{
+				case StatementType::expression:
+				{
+					ASSERT(statement->assertion.corresponding_statement->expression.is_cached);
+					resultant_value = get_value_number(statement->assertion.corresponding_statement->expression.cached_evaluation);
+				} break;
+
+				case StatementType::variable_declaration:
+				{
+					ASSERT(statement->assertion.corresponding_statement->variable_declaration.status == VariableDeclarationStatus::cached);
+					resultant_value = get_value_number(statement->assertion.corresponding_statement->variable_declaration.cached_evaluation);
+				} break;
+
+				default:
+				{
+					ASSERT(false); // Unknown assertion case.
+				} break;
+			}
+
+			if (fabs(resultant_value - expectant_value) < static_cast<Number>(0.000001))
+			{
+				output_string(STRING_VIEW_OF("Passed assertion :: "));
+				output_number(expectant_value);
+				output_string(STRING_VIEW_OF(" :: "));
+				DEBUG_print_serialized_syntax_tree(statement->assertion.corresponding_statement->tree);
+				output_char('\n');
+			}
+			else
+			{
+				output_string(STRING_VIEW_OF("Failed assertion :: "));
+				output_number(expectant_value);
+				output_string(STRING_VIEW_OF(" :: resultant value :: "));
+				output_number(resultant_value);
+				output_string(STRING_VIEW_OF(" :: "));
+				DEBUG_print_serialized_syntax_tree(statement->assertion.corresponding_statement->tree);
+				output_char('\n');
+				flush_output();
+				ASSERT(false); // Failed meat assertion.
+			}
+		} break;
+
+		case StatementType::expression:
+		{
+			if (!statement->expression.is_cached)
+			{
+				switch (statement->tree->token.kind)
+				{
+					case TokenKind::identifier:
+					{
+						ASSERT(!statement->tree->left);
+						ASSERT(!statement->tree->right);
+
+						FOR_NODES(binded_args)
+						{
+							if (it->name == statement->tree->token.string)
+							{
+								statement->expression.cached_evaluation = it->value;
+								statement->expression.is_cached         = true;
+								return;
+							}
+						}
+
+						if (auto it = find_predefined_constant(statement->tree->token.string))
+						{
+							statement->expression.cached_evaluation = box_number(it->value);
+							statement->expression.is_cached         = true;
+							return;
+						}
+
+						FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+						{
+							if (it->type == StatementType::variable_declaration && it->tree->left->token.string == statement->tree->token.string)
+							{
+								evaluate_statement(it, ledger, allocator);
+								statement->expression.cached_evaluation = it->variable_declaration.cached_evaluation;
+								statement->expression.is_cached         = true;
+								return;
+							}
+						}
+
+						ASSERT(false); // Couldn't find declaration.
+					} break;
+
+					case TokenKind::number:
+					{
+						ASSERT(!statement->tree->left);
+						ASSERT(!statement->tree->right);
+						if (is_integer_literal(statement->tree, ledger))
+						{
+							statement->expression.cached_evaluation = parse_integer(allocator, statement->tree->token.string);
+						}
+						else
+						{
+							statement->expression.cached_evaluation = box_number(statement->tree->number);
+						}
+						statement->expression.is_cached = true;
+					} break;
+
+					case TokenKind::plus:
+					{
+						statement->expression.cached_evaluation = apply_binary_operator<ArrayAddition>(allocator, evaluate_expression(statement->tree->left), evaluate_expression(statement->tree->right));
+						statement->expression.is_cached         = true;
+					} break;
+
+					case TokenKind::minus:
+					{
+						if (statement->tree->left)
+						{
+							statement->expression.cached_evaluation = apply_binary_operator<ArraySubtraction>(allocator, evaluate_expression(statement->tree->left), evaluate_expression(statement->tree->right));
+						}
+						else
+						{
+							statement->expression.cached_evaluation = apply_unary_operator<ArrayNegation>(allocator, evaluate_expression(statement->tree->right));
+						}
+						statement->expression.is_cached = true;
+					} break;
+
+					case TokenKind::asterisk:
+					{
+						statement->expression.cached_evaluation = apply_binary_operator<ArrayMultiplication>(allocator, evaluate_expression(statement->tree->left), evaluate_expression(statement->tree->right));
+						statement->expression.is_cached         = true;
+					} break;
+
+					case TokenKind::forward_slash:
+					{
+						statement->expression.cached_evaluation = apply_binary_operator<ArrayDivision>(allocator, evaluate_expression(statement->tree->left), evaluate_expression(statement->tree->right));
+						statement->expression.is_cached         = true;
+					} break;
+
+					case TokenKind::caret:
+					{
+						statement->expression.cached_evaluation = apply_binary_operator<ArrayExponentiation>(allocator, evaluate_expression(statement->tree->left), evaluate_expression(statement->tree->right));
+						statement->expression.is_cached         = true;
+					} break;
+
+					case TokenKind::exclamation_point:
+					{
+						ASSERT(!statement->tree->right);
+						statement->expression.cached_evaluation = apply_unary_operator<ArrayFactorial>(allocator, evaluate_expression(statement->tree->left));
+						statement->expression.is_cached         = true;
+					} break;
+
+					case TokenKind::parenthetical_application:
+					{
+						if (statement->tree->left)
+						{
+							if (statement->tree->left->token.kind == TokenKind::identifier)
+							{
+								if (auto it = find_functional(statement->tree->left->token.string))
+								{
+									SyntaxTree* function_tree = statement->tree->right->left;
+									ASSERT(function_tree->token.kind == TokenKind::identifier); // Functionals take the name of a function.
+
+									Statement* function = find_function_declaration(ledger, function_tree->token.string);
+									ASSERT(function);                                                                               // Couldn't find declaration.
+									ASSERT(function->function_declaration.args && !function->function_declaration.args->next_node); // Functionals take functions of one argument.
+
+									Number argument_buffer[FUNCTIONAL_MAX_ARITY - 1];
+									i32    argument_count = 0;
+									for (SyntaxTree* current = statement->tree->right->right; current; current = current->token.kind == TokenKind::comma ? current->right : 0)
+									{
+										Value argument = evaluate_expression(current->token.kind == TokenKind::comma ? current->left : current);
+										ASSERT(is_scalar_value(argument)); // Functionals take numbers after the function.
+
+										argument_buffer[argument_count]  = get_value_number(argument);
+										argument_count                  += 1;
+									}
+
+									statement->expression.cached_evaluation = box_number(evaluate_functional(it->type, function, argument_buffer, ledger, allocator));
+									statement->expression.is_cached         = true;
+									return;
+								}
+
+								if (auto it = find_predefined_function(statement->tree->left->token.string))
+								{
+									FunctionArgumentNode* arguments = 0;
+									DEFER { deinit_entire_function_argument_node(allocator, arguments); };
+
+									FunctionArgumentNode** arguments_nil = &arguments;
+									for (SyntaxTree* current_parameter_tree = statement->tree->right; current_parameter_tree; current_parameter_tree = current_parameter_tree->right)
+									{
+										if (current_parameter_tree->token.kind == TokenKind::comma)
+										{
+											*arguments_nil = init_function_argument_node(allocator, {}, evaluate_expression(current_parameter_tree->left));
+										}
+										else
+										{
+											*arguments_nil = init_function_argument_node(allocator, {}, evaluate_expression(current_parameter_tree));
+											break;
+										}
+
+										arguments_nil = &(*arguments_nil)->next_node;
+									}
+
+									statement->expression.cached_evaluation = apply_predefined_function(it, arguments, allocator);
+									statement->expression.is_cached         = true;
+									return;
+								}
+
+								FOR_ELEMS(function, ledger->statement_buffer, ledger->statement_count)
+								{
+									if (function->type == StatementType::function_declaration && function->tree->left->left->token.string == statement->tree->left->token.string)
+									{
+										FunctionArgumentNode* new_binded_args = 0;
+										DEFER { deinit_entire_function_argument_node(allocator, new_binded_args); };
+
+										FunctionArgumentNode** new_binded_args_nil    = &new_binded_args;
+										FunctionArgumentNode*  current_function_arg   = function->function_declaration.args;
+										SyntaxTree*            current_parameter_tree = statement->tree->right;
+										while (true)
+										{
+											if (current_parameter_tree->token.kind == TokenKind::comma)
+											{
+												*new_binded_args_nil = init_function_argument_node(allocator, current_function_arg->name, evaluate_expression(current_parameter_tree->left));
+												current_function_arg = current_function_arg->next_node;
+											}
+											else
+											{
+												*new_binded_args_nil = init_function_argument_node(allocator, current_function_arg->name, evaluate_expression(current_parameter_tree));
+												current_function_arg = current_function_arg->next_node;
+												break;
+											}
+
+											current_parameter_tree = current_parameter_tree->right;
+											new_binded_args_nil    = &(*new_binded_args_nil)->next_node;
+										}
+
+										ASSERT(current_function_arg == 0);
 
 										Statement exp = {};
 										exp.tree = function->tree->right;
@@ -1038,105 +3563,2233 @@ internal void evaluate_statement(Statement* statement, Ledger* ledger, Allocator
 								}
 							}
 
-							statement->expression.cached_evaluation = evaluate_expression(statement->tree->left) * evaluate_expression(statement->tree->right);
-						}
-						else
-						{
-							statement->expression.cached_evaluation = evaluate_expression(statement->tree->right);
-						}
-						statement->expression.is_cached = true;
-					} break;
+							statement->expression.cached_evaluation = apply_binary_operator<ArrayMultiplication>(allocator, evaluate_expression(statement->tree->left), evaluate_expression(statement->tree->right));
+						}
+						else
+						{
+							statement->expression.cached_evaluation = evaluate_expression(statement->tree->right);
+						}
+						statement->expression.is_cached = true;
+					} break;
+
+					case TokenKind::inlined_application:
+					{
+						statement->expression.cached_evaluation = evaluate_expression(statement->tree->right);
+						statement->expression.is_cached         = true;
+					} break;
+
+					case TokenKind::array:
+					{
+						SyntaxTree* elements = statement->tree->right;
+						if (elements->token.kind == TokenKind::colon)
+						{
+							SyntaxTree* last_tree = elements->right->token.kind == TokenKind::colon ? elements->right->left  : elements->right;
+							SyntaxTree* step_tree = elements->right->token.kind == TokenKind::colon ? elements->right->right : 0;
+
+							Value first = evaluate_expression(elements->left);
+							Value last  = evaluate_expression(last_tree);
+							Value step  = step_tree ? evaluate_expression(step_tree) : box_number(1.0f);
+							ASSERT(is_scalar_value(first) && is_scalar_value(last) && is_scalar_value(step)); // Ranges are made of numbers.
+
+							statement->expression.cached_evaluation = evaluate_array_range(allocator, get_value_number(first), get_value_number(last), get_value_number(step));
+						}
+						else
+						{
+							i32 count = 0;
+							for (SyntaxTree* current = elements; current; current = current->token.kind == TokenKind::comma ? current->right : 0)
+							{
+								count += 1;
+							}
+
+							ValueArray* array = init_value_array(allocator, count);
+							i32         index = 0;
+							for (SyntaxTree* current = array ? elements : 0; current; current = current->token.kind == TokenKind::comma ? current->right : 0)
+							{
+								Value element = evaluate_expression(current->token.kind == TokenKind::comma ? current->left : current);
+								ASSERT(is_scalar_value(element)); // Arrays cannot be nested.
+
+								array->elements[index]  = static_cast<Element>(get_value_number(element));
+								index                  += 1;
+							}
+
+							statement->expression.cached_evaluation = array ? box_array(array) : box_number(NAN);
+						}
+						statement->expression.is_cached = true;
+					} break;
+
+					default:
+					{
+						ASSERT(false); // Unknown token.
+					} break;
+				}
+			}
+		} break;
+
+		case StatementType::variable_declaration:
+		{
+			switch (statement->variable_declaration.status)
+			{
+				case VariableDeclarationStatus::yet_calculated:
+				{
+					if (ledger->value_cache)
+					{
+						ValueCacheEntry* entry = find_value_cache_entry(ledger->value_cache, statement->variable_declaration.hash);
+						if (entry->hash)
+						{
+							ledger->value_cache->hit_count                    += 1;
+							statement->variable_declaration.cached_evaluation  = box_number(entry->value);
+							statement->variable_declaration.status             = VariableDeclarationStatus::cached;
+							return;
+						}
+						ledger->value_cache->miss_count += 1;
+					}
+
+					statement->variable_declaration.status            = VariableDeclarationStatus::currently_calculating;
+					statement->variable_declaration.cached_evaluation = evaluate_expression(statement->tree->right);
+					statement->variable_declaration.status            = VariableDeclarationStatus::cached;
+				} break;
+
+				case VariableDeclarationStatus::currently_calculating:
+				{
+					ASSERT(false); // Circlar definition.
+				} break;
+
+				case VariableDeclarationStatus::cached:
+				{
+				} break;
+
+				default:
+				{
+					ASSERT(false); // Unknown variable declaration status.
+				} break;
+			};
+		} break;
+
+		case StatementType::function_declaration:
+		{
+		} break;
+
+		default:
+		{
+			ASSERT(false); // Unknown statement type.
+		} break;
+	}
+}
+
+//
+// Reductions.
+//
+
+// @NOTE@ `sum(f, first, last)` and `prod(f, first, last)` apply the one-parameter function `f` to `first`, `first + 1` and so on up to
+// `last`, then add or multiply the terms. The terms are split into blocks of `REDUCTION_BLOCK_SIZE`; each block is reduced pairwise, and
+// then so are the results of the blocks, in order. The result therefore depends only on the terms and never on how many workers there
+// were or which blocks they took, and the rounding error grows with the logarithm of the term count rather than with the count.
+//
+// When nothing the function refers to builds an array or reduces again, a whole block is evaluated at once by binding the parameter to an
+// array of the block's arguments, so the body goes through the array operators once per block. Otherwise, and in mixed builds where the
+// elements of arrays are narrower than numbers, the terms are evaluated one at a time. Large reductions are spread over workers, each
+// with its own copy of the statements as in a sweep; a reduction that is already being evaluated on a worker runs serially.
+
+global constexpr i32     REDUCTION_BLOCK_SIZE                     = 256;
+global constexpr i32     REDUCTION_PAIRWISE_BASE                  = 8;                 // @NOTE@ Terms combined in a plain loop once a range is this small.
+global constexpr i32     REDUCTION_PARALLEL_BLOCK_COUNT           = 32;                // @NOTE@ Fewer blocks than this are not worth starting workers for...
+global constexpr i32     REDUCTION_TERM_WISE_PARALLEL_BLOCK_COUNT = 4;                 // @NOTE@ ...unless every term is evaluated on its own.
+global constexpr i32     REDUCTION_GRANULARITY                    = 2;                 // @NOTE@ Blocks per job.
+global constexpr memsize REDUCTION_SCRATCH_SIZE_PER_WORKER        = KIBIBYTES_OF(256);
+global constexpr memsize REDUCTION_VALUE_ARENA_SIZE_PER_WORKER    = KIBIBYTES_OF(192); // @NOTE@ Taken out of the scratch arena.
+
+// @NOTE@ Term `i` applies the function to `first + i`, or to `argument_buffer[i]` when there is one.
+struct FunctionTerms
+{
+	Statement* function;
+	Number     first;
+	Number*    argument_buffer;
+	i32        count;
+	bool32     is_by_block;
+};
+
+typedef void TermBlockFunction(void* data, i32 block_index, Ledger* ledger, Allocator* allocator);
+
+struct TermBlocks
+{
+	Ledger*                        ledger;
+	TermBlockFunction*             function;
+	void*                          data;
+	std::atomic<const StringView*> evaluation_error; // @NOTE@ The first error met by any worker, handed to the calling allocator.
+};
+
+template <typename OPERATION>
+internal Number reduce_pairwise(Number* buffer, i32 count)
+{
+	if (count <= REDUCTION_PAIRWISE_BASE)
+	{
+		Number result = buffer[0];
+		FOR_RANGE(i, 1, count)
+		{
+			result = OPERATION::scalar(result, buffer[i]);
+		}
+		return result;
+	}
+
+	i32 half = count / 2;
+	return OPERATION::scalar(reduce_pairwise<OPERATION>(buffer, half), reduce_pairwise<OPERATION>(buffer + half, count - half));
+}
+
+// @NOTE@ Whether the tree, and every declaration it refers to, gives the right terms with an array in place of each number. Declarations
+// and memoized nodes don't depend on the parameter, so they are evaluated here, before the first term: their values then sit below any
+// point the value arena is reset to, as integers and arrays kept in them must. Those that come out a number need not be looked into.
+internal bool32 is_reducible_by_block(SyntaxTree* tree, Ledger* ledger, Allocator* allocator, u64* visited_mask)
+{
+	if (!tree)
+	{
+		return true;
+	}
+	else if (tree->memo_index)
+	{
+		return is_scalar_value(evaluate_tree(tree, ledger, allocator));
+	}
+	else if (tree->token.kind == TokenKind::array)
+	{
+		return false;
+	}
+	else if (tree->token.kind == TokenKind::identifier)
+	{
+		if (find_functional(tree->token.string))
+		{
+			return false;
+		}
+
+		FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+		{
+			if (it->type == StatementType::variable_declaration && it->tree->left->token.string == tree->token.string)
+			{
+				evaluate_statement(it, ledger, allocator);
+				return is_scalar_value(it->variable_declaration.cached_evaluation);
+			}
+			else if (!(it->type == StatementType::function_declaration && it->tree->left->left->token.string == tree->token.string))
+			{
+				continue;
+			}
+
+			u64 bit = 1ULL << it_index;
+			if (*visited_mask & bit)
+			{
+				return true;
+			}
+			*visited_mask |= bit;
+
+			return is_reducible_by_block(it->tree->right, ledger, allocator, visited_mask);
+		}
+
+		return true;
+	}
+
+	return is_reducible_by_block(tree->left, ledger, allocator, visited_mask) && is_reducible_by_block(tree->right, ledger, allocator, visited_mask);
+}
+
+internal Number get_term_argument(FunctionTerms* terms, i32 index)
+{
+	return terms->argument_buffer ? terms->argument_buffer[index] : terms->first + static_cast<Number>(index);
+}
+
+// @NOTE@ Writes the terms from `start` into `value_buffer`, which may be the matching part of the argument buffer itself. Arrays made for a
+// block are dropped once it is evaluated. Terms evaluated one at a time keep theirs, since then the function may have cached arrays in
+// declarations along the way.
+internal void evaluate_function_terms(FunctionTerms* terms, i32 start, i32 count, Number* value_buffer, Ledger* ledger, Allocator* allocator)
+{
+	memsize value_arena_used = allocator->value_arena.used;
+	DEFER
+	{
+		if (terms->is_by_block)
+		{
+			allocator->value_arena.used = value_arena_used;
+		}
+	};
+
+	FunctionArgumentNode* argument = init_function_argument_node(allocator, terms->function->function_declaration.args->name);
+	DEFER { deinit_entire_function_argument_node(allocator, argument); };
+
+	Statement exp = {};
+	exp.tree = terms->function->tree->right;
+	exp.type = StatementType::expression;
+
+	if (terms->is_by_block)
+	{
+		ValueArray* arguments = init_value_array(allocator, count);
+		if (!arguments)
+		{
+			FOR_RANGE(i, count)
+			{
+				value_buffer[i] = NAN;
+			}
+			return;
+		}
+
+		FOR_RANGE(i, count)
+		{
+			arguments->elements[i] = static_cast<Element>(get_term_argument(terms, start + i));
+		}
+
+		argument->value = box_array(arguments);
+		evaluate_statement(&exp, ledger, allocator, argument);
+		ASSERT(exp.expression.is_cached);
+
+		Value values = exp.expression.cached_evaluation;
+		if (is_scalar_value(values)) // @NOTE@ The body does not depend on its parameter.
+		{
+			FOR_RANGE(i, count)
+			{
+				value_buffer[i] = get_value_number(values);
+			}
+		}
+		else
+		{
+			ASSERT(unbox_array(values)->count == count);
+			FOR_RANGE(i, count)
+			{
+				value_buffer[i] = static_cast<Number>(unbox_array(values)->elements[i]);
+			}
+		}
+	}
+	else
+	{
+		FOR_RANGE(i, count)
+		{
+			argument->value          = box_number(get_term_argument(terms, start + i));
+			exp.expression.is_cached = false;
+			evaluate_statement(&exp, ledger, allocator, argument);
+			ASSERT(exp.expression.is_cached);
+			ASSERT(is_scalar_value(exp.expression.cached_evaluation)); // Terms must be numbers.
+
+			value_buffer[i] = get_value_number(exp.expression.cached_evaluation);
+		}
+	}
+}
+
+// @NOTE@ Ranges are offset by one, since the first block is always evaluated on the calling thread.
+internal void evaluate_term_blocks_on_worker(JobWorker* worker, i32 start, i32 end, void* data)
+{
+	TermBlocks* blocks = reinterpret_cast<TermBlocks*>(data);
+
+	// @NOTE@ Allocates from a copy of the scratch arena, so everything is dropped when the range is done.
+	Allocator allocator = {};
+	allocator.arena       = worker->scratch;
+	allocator.value_arena = memory_arena_reserve(&allocator.arena, REDUCTION_VALUE_ARENA_SIZE_PER_WORKER);
+
+	Ledger* ledger = memory_arena_allocate<Ledger>(&allocator.arena);
+	*ledger                   = *blocks->ledger;
+	ledger->value_cache       = 0;
+	ledger->memo_epoch        = 1;
+	ledger->memo_value_buffer = memory_arena_allocate_zero<Value>(&allocator.arena, ledger->memo_count + 1);
+	ledger->memo_epoch_buffer = memory_arena_allocate_zero<u32>(&allocator.arena, ledger->memo_count + 1);
+	ledger->is_on_worker      = true;
+
+	FOR_RANGE(block, start + 1, end + 1)
+	{
+		blocks->function(blocks->data, block, ledger, &allocator);
+	}
+
+	if (allocator.evaluation_error)
+	{
+		const StringView* expected = 0;
+		blocks->evaluation_error.compare_exchange_strong(expected, allocator.evaluation_error);
+	}
+
+	ASSERT(allocator.allocated_function_argument_node_count == 0);
+}
+
+// @NOTE@ Calls `function` once for every block of the terms, with the ledger and allocator to evaluate that block with.
+internal void evaluate_term_blocks(FunctionTerms* terms, TermBlockFunction* function, void* data, Ledger* ledger, Allocator* allocator)
+{
+	i32 block_count          = (terms->count + REDUCTION_BLOCK_SIZE - 1) / REDUCTION_BLOCK_SIZE;
+	i32 parallel_block_count = terms->is_by_block ? REDUCTION_PARALLEL_BLOCK_COUNT : REDUCTION_TERM_WISE_PARALLEL_BLOCK_COUNT;
+
+	// @NOTE@ Done first and here so that whatever the function refers to is cached before the workers copy the statements.
+	function(data, 0, ledger, allocator);
+
+	// @NOTE@ Only one reduction at a time gets the workers; any other, such as one on another thread of an embedder, runs serially.
+	persist std::atomic<bool32> is_job_system_taken;
+	if (!ledger->is_on_worker && block_count >= parallel_block_count && !is_job_system_taken.exchange(true, std::memory_order_acquire))
+	{
+		MemoryArena arena;
+		arena.size = ARRAY_CAPACITY(JobSystem, workers) * REDUCTION_SCRATCH_SIZE_PER_WORKER;
+		arena.base = reinterpret_cast<byte*>(malloc(arena.size));
+		arena.used = 0;
+
+		TermBlocks blocks = {};
+		blocks.ledger           = ledger;
+		blocks.function         = function;
+		blocks.data             = data;
+		blocks.evaluation_error = 0;
+
+		persist JobSystem job_system;
+		init_job_system(&job_system, &arena, 0, REDUCTION_SCRATCH_SIZE_PER_WORKER);
+		job_parallel_for(&job_system.workers[0], block_count - 1, REDUCTION_GRANULARITY, evaluate_term_blocks_on_worker, &blocks);
+		deinit_job_system(&job_system);
+
+		if (blocks.evaluation_error.load())
+		{
+			report_evaluation_error(allocator, blocks.evaluation_error.load());
+		}
+
+		free(arena.base);
+		is_job_system_taken.store(false, std::memory_order_release);
+	}
+	else
+	{
+		FOR_RANGE(block, 1, block_count)
+		{
+			function(data, block, ledger, allocator);
+		}
+	}
+}
+
+struct Reduction
+{
+	FunctionTerms terms;
+	Number*       block_result_buffer;
+};
+
+template <typename OPERATION>
+internal void reduce_term_block(void* data, i32 block_index, Ledger* ledger, Allocator* allocator)
+{
+	Reduction* reduction        = reinterpret_cast<Reduction*>(data);
+	memsize    value_arena_used = allocator->value_arena.used;
+	i32        start            = block_index * REDUCTION_BLOCK_SIZE;
+	i32        count            = min(REDUCTION_BLOCK_SIZE, reduction->terms.count - start);
+	Number*    value_buffer     = memory_arena_allocate<Number>(&allocator->value_arena, count);
+
+	evaluate_function_terms(&reduction->terms, start, count, value_buffer, ledger, allocator);
+	reduction->block_result_buffer[block_index] = reduce_pairwise<OPERATION>(value_buffer, count);
+
+	if (reduction->terms.is_by_block)
+	{
+		allocator->value_arena.used = value_arena_used;
+	}
+}
+
+template <typename OPERATION>
+internal Number reduce_function(Statement* function, Number first, Number last, Number identity, Ledger* ledger, Allocator* allocator)
+{
+	Number span = last - first;
+	if (!(span >= 0))
+	{
+		return identity; // @NOTE@ No terms.
+	}
+	ASSERT(span < static_cast<Number>(1 << 30)); // Too many terms.
+
+	u64       visited_mask     = 0;
+	bool32    is_by_block      = sizeof(Element) == sizeof(Number) && is_reducible_by_block(function->tree->right, ledger, allocator, &visited_mask);
+	memsize   value_arena_used = allocator->value_arena.used;
+	Reduction reduction        = {};
+	reduction.terms.function    = function;
+	reduction.terms.first       = first;
+	reduction.terms.count       = static_cast<i32>(floor(span + static_cast<Number>(0.0001))) + 1;
+	reduction.terms.is_by_block = is_by_block;
+
+	i32 block_count = (reduction.terms.count + REDUCTION_BLOCK_SIZE - 1) / REDUCTION_BLOCK_SIZE;
+	reduction.block_result_buffer = memory_arena_allocate<Number>(&allocator->value_arena, block_count);
+
+	evaluate_term_blocks(&reduction.terms, reduce_term_block<OPERATION>, &reduction, ledger, allocator);
+
+	Number result = reduce_pairwise<OPERATION>(reduction.block_result_buffer, block_count);
+	if (reduction.terms.is_by_block)
+	{
+		allocator->value_arena.used = value_arena_used;
+	}
+	return result;
+}
+
+// @NOTE@ `integrate(f, a, b)` applies the 15-point Gauss-Kronrod rule to `f` over panels of the interval, starting with the whole of it.
+// The difference from the 7-point Gauss rule nested in it estimates each panel's error. A panel is kept when its error is within its
+// share, by width, of the tolerance on the whole integral, and is otherwise halved, until every panel is kept or the panel budget is
+// spent. Each round evaluates the nodes of every panel still being refined as the terms of one reduction, so they go through the body a
+// block at a time and are spread over workers when there are enough of them. The kept panels are summed pairwise in the order they were
+// kept, which depends only on the function, so the result is the same however many workers there were.
+
+global constexpr i32 KRONROD_NODE_COUNT          = 15;
+global constexpr i32 INTEGRATION_MAX_PANEL_COUNT = 256;
+
+global constexpr Number INTEGRATION_RELATIVE_TOLERANCE = static_cast<Number>(sizeof(Number) == sizeof(f32) ? 1e-5 : 1e-10);
+global constexpr Number INTEGRATION_ABSOLUTE_TOLERANCE = static_cast<Number>(1e-30);
+
+// @NOTE@ The nonnegative abscissas of the Kronrod rule on [-1, 1], from the outermost in, and their weights. The abscissas at odd indices
+// are those of the Gauss rule, which weights them, and the middle, by `GAUSS_WEIGHTS`.
+global constexpr f64 KRONROD_ABSCISSAS[] =
+	{
+		0.991455371120812639206854697526329, 0.949107912342758524526189684047851, 0.864864423359769072789712788640926,
+		0.741531185599394439863864773280788, 0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+		0.207784955007898467600689403773245, 0.000000000000000000000000000000000,
+	};
+global constexpr f64 KRONROD_WEIGHTS[] =
+	{
+		0.022935322010529224963732008058970, 0.063092092629978553290700663189204, 0.104790010322250183839876322541518,
+		0.140653259715525918745189590510238, 0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+		0.204432940075298892414161999234649, 0.209482141084727828012999174891714,
+	};
+global constexpr f64 GAUSS_WEIGHTS[] =
+	{
+		0.129484966168869693270611432679082, 0.279705391489276667901467771423780, 0.381830050505118944950369775488975,
+		0.417959183673469387755102040816327,
+	};
+
+struct QuadraturePanel
+{
+	Number left;
+	Number right;
+};
+
+// @NOTE@ Nodes are replaced by the values of the function at them.
+internal void evaluate_quadrature_block(void* data, i32 block_index, Ledger* ledger, Allocator* allocator)
+{
+	FunctionTerms* terms = reinterpret_cast<FunctionTerms*>(data);
+	i32            start = block_index * REDUCTION_BLOCK_SIZE;
+	evaluate_function_terms(terms, start, min(REDUCTION_BLOCK_SIZE, terms->count - start), terms->argument_buffer + start, ledger, allocator);
+}
+
+internal Number integrate_function(Statement* function, Number a, Number b, Ledger* ledger, Allocator* allocator)
+{
+	if (a == b)
+	{
+		return 0;
+	}
+	ASSERT(isfinite(a) && isfinite(b)); // Integrals are bounded by finite numbers.
+
+	u64           visited_mask     = 0;
+	bool32        is_by_block      = sizeof(Element) == sizeof(Number) && is_reducible_by_block(function->tree->right, ledger, allocator, &visited_mask);
+	memsize       value_arena_used = allocator->value_arena.used;
+	FunctionTerms terms            = {};
+	terms.function        = function;
+	terms.argument_buffer = memory_arena_allocate<Number>(&allocator->value_arena, INTEGRATION_MAX_PANEL_COUNT * KRONROD_NODE_COUNT);
+	terms.is_by_block     = is_by_block;
+
+	QuadraturePanel* panel_buffer      = memory_arena_allocate<QuadraturePanel>(&allocator->value_arena, INTEGRATION_MAX_PANEL_COUNT);
+	QuadraturePanel* next_panel_buffer = memory_arena_allocate<QuadraturePanel>(&allocator->value_arena, INTEGRATION_MAX_PANEL_COUNT);
+	Number*          estimate_buffer   = memory_arena_allocate<Number>(&allocator->value_arena, INTEGRATION_MAX_PANEL_COUNT);
+	Number*          error_buffer      = memory_arena_allocate<Number>(&allocator->value_arena, INTEGRATION_MAX_PANEL_COUNT);
+	Number*          kept_buffer       = memory_arena_allocate<Number>(&allocator->value_arena, INTEGRATION_MAX_PANEL_COUNT);
+	i32              panel_count       = 1;
+	i32              kept_count        = 0;
+	Number           kept_total        = 0;
+	Number           width             = fabs(b - a);
+
+	panel_buffer[0] = { a, b };
+	while (panel_count)
+	{
+		FOR_RANGE(i, panel_count)
+		{
+			Number  middle    = (panel_buffer[i].left + panel_buffer[i].right) / 2;
+			Number  half      = (panel_buffer[i].right - panel_buffer[i].left) / 2;
+			Number* node_list = terms.argument_buffer + i * KRONROD_NODE_COUNT;
+			FOR_RANGE(j, ARRAY_CAPACITY(KRONROD_ABSCISSAS) - 1)
+			{
+				node_list[j * 2 + 0] = middle - half * static_cast<Number>(KRONROD_ABSCISSAS[j]);
+				node_list[j * 2 + 1] = middle + half * static_cast<Number>(KRONROD_ABSCISSAS[j]);
+			}
+			node_list[KRONROD_NODE_COUNT - 1] = middle;
+		}
+
+		terms.count = panel_count * KRONROD_NODE_COUNT;
+		evaluate_term_blocks(&terms, evaluate_quadrature_block, &terms, ledger, allocator);
+
+		Number total = kept_total;
+		FOR_RANGE(i, panel_count)
+		{
+			Number* value_list = terms.argument_buffer + i * KRONROD_NODE_COUNT;
+			Number  kronrod    = static_cast<Number>(KRONROD_WEIGHTS[ARRAY_CAPACITY(KRONROD_WEIGHTS) - 1]) * value_list[KRONROD_NODE_COUNT - 1];
+			Number  gauss      = static_cast<Number>(GAUSS_WEIGHTS  [ARRAY_CAPACITY(GAUSS_WEIGHTS  ) - 1]) * value_list[KRONROD_NODE_COUNT - 1];
+			FOR_RANGE(j, ARRAY_CAPACITY(KRONROD_ABSCISSAS) - 1)
+			{
+				Number pair = value_list[j * 2 + 0] + value_list[j * 2 + 1];
+				kronrod += static_cast<Number>(KRONROD_WEIGHTS[j]) * pair;
+				if (j % 2)
+				{
+					gauss += static_cast<Number>(GAUSS_WEIGHTS[j / 2]) * pair;
+				}
+			}
+
+			Number half = (panel_buffer[i].right - panel_buffer[i].left) / 2;
+			estimate_buffer[i]  = kronrod * half;
+			error_buffer   [i]  = fabs((kronrod - gauss) * half);
+			total              += estimate_buffer[i];
+		}
+
+		Number tolerance        = max(INTEGRATION_ABSOLUTE_TOLERANCE, INTEGRATION_RELATIVE_TOLERANCE * fabs(total));
+		i32    next_panel_count = 0;
+		FOR_RANGE(i, panel_count)
+		{
+			QuadraturePanel panel  = panel_buffer[i];
+			Number          middle = (panel.left + panel.right) / 2;
+
+			bool32 is_accurate =
+				error_buffer[i] <= tolerance * fabs(panel.right - panel.left) / width ||
+				error_buffer[i] <= INTEGRATION_RELATIVE_TOLERANCE * fabs(estimate_buffer[i]);
+			bool32 is_divisible =
+				middle != panel.left && middle != panel.right &&
+				kept_count + next_panel_count + (panel_count - i) + 1 <= INTEGRATION_MAX_PANEL_COUNT;
+
+			if (!is_accurate && is_divisible)
+			{
+				next_panel_buffer[next_panel_count + 0]  = { panel.left, middle      };
+				next_panel_buffer[next_panel_count + 1]  = { middle    , panel.right };
+				next_panel_count                        += 2;
+			}
+			else
+			{
+				kept_buffer[kept_count]  = estimate_buffer[i];
+				kept_count              += 1;
+				kept_total              += estimate_buffer[i];
+			}
+		}
+
+		SWAP(&panel_buffer, &next_panel_buffer);
+		panel_count = next_panel_count;
+	}
+
+	Number result = reduce_pairwise<ArrayAddition>(kept_buffer, kept_count);
+	if (terms.is_by_block)
+	{
+		allocator->value_arena.used = value_arena_used;
+	}
+	return result;
+}
+
+//
+// Derivatives.
+//
+
+// @NOTE@ `derivative(f, x)` evaluates the one-parameter function `f` once with its parameter bound to the dual number `{ x, 1 }`, so every
+// operator and built-in carries the derivative along by the chain rule. That is exact up to rounding, where a difference quotient needs
+// two evaluations and still loses half the digits. `solve(f, x)` finds a root of `f` by Newton's method from `x`, taking the value and the
+// slope of each step from one such evaluation; it gives NaN when the slope vanishes or the steps have not settled after
+// `SOLVE_MAX_STEP_COUNT`. Arrays can't be differentiated, and neither can the bounds of a functional.
+
+global constexpr i32    SOLVE_MAX_STEP_COUNT = 64;
+global constexpr Number SOLVE_TOLERANCE      = static_cast<Number>(sizeof(Number) == sizeof(f32) ? 1e-6 : 1e-13); // @NOTE@ Relative to the root once it is past one.
+
+// @NOTE@ Dual numbers are dropped once the function is evaluated, unless it may have cached arrays in declarations along the way; the
+// same test decides whether a reduction can drop its blocks.
+internal Dual differentiate_function(Statement* function, Number x, Ledger* ledger, Allocator* allocator)
+{
+	u64     visited_mask     = 0;
+	bool32  is_droppable     = is_reducible_by_block(function->tree->right, ledger, allocator, &visited_mask);
+	memsize value_arena_used = allocator->value_arena.used;
+
+	FunctionArgumentNode* argument = init_function_argument_node(allocator, function->function_declaration.args->name, box_dual(init_value_dual(allocator, x, 1)));
+	DEFER { deinit_entire_function_argument_node(allocator, argument); };
+
+	Statement exp = {};
+	exp.tree = function->tree->right;
+	exp.type = StatementType::expression;
+	evaluate_statement(&exp, ledger, allocator, argument);
+	ASSERT(exp.expression.is_cached);
+
+	Dual result = get_value_dual(exp.expression.cached_evaluation); // @NOTE@ A number if the body does not depend on its parameter.
+	if (is_droppable)
+	{
+		allocator->value_arena.used = value_arena_used;
+	}
+	return result;
+}
+
+internal Number solve_function(Statement* function, Number x, Ledger* ledger, Allocator* allocator)
+{
+	FOR_RANGE(SOLVE_MAX_STEP_COUNT)
+	{
+		Dual y = differentiate_function(function, x, ledger, allocator);
+		if (y.value == 0)
+		{
+			return x;
+		}
+
+		Number step = y.value / y.derivative;
+		if (!isfinite(step))
+		{
+			break;
+		}
+
+		x -= step;
+		if (fabs(step) <= SOLVE_TOLERANCE * max(static_cast<Number>(1), fabs(x)))
+		{
+			return x;
+		}
+	}
+
+	return NAN;
+}
+
+// @NOTE@ The arguments after the function, as many as the functional's arity less one.
+internal Number evaluate_functional(FunctionalType type, Statement* function, Number* argument_buffer, Ledger* ledger, Allocator* allocator)
+{
+	switch (type)
+	{
+		case FunctionalType::sum       : return reduce_function<ArrayAddition      >(function, argument_buffer[0], argument_buffer[1], 0, ledger, allocator);
+		case FunctionalType::product   : return reduce_function<ArrayMultiplication>(function, argument_buffer[0], argument_buffer[1], 1, ledger, allocator);
+		case FunctionalType::integral  : return integrate_function(function, argument_buffer[0], argument_buffer[1], ledger, allocator);
+		case FunctionalType::derivative: return differentiate_function(function, argument_buffer[0], ledger, allocator).derivative;
+		case FunctionalType::root      : return solve_function(function, argument_buffer[0], ledger, allocator);
+		default                        : ASSERT(false); return 0; // Unknown functional type.
+	}
+}
+
+//
+// Queries.
+//
+
+// @NOTE@ Declarations are evaluated on demand, so evaluating only the targets already touches nothing else. The dependency mask is
+// only used for reporting; a parameter that shares a name with a declaration marks that declaration too, so it can overestimate.
+
+internal void mark_statement_dependencies(u64* dependency_mask, Statement* statement, Ledger* ledger);
+
+internal void mark_syntax_tree_dependencies(u64* dependency_mask, SyntaxTree* tree, Ledger* ledger)
+{
+	if (!tree)
+	{
+		return;
+	}
+	else if (tree->token.kind == TokenKind::inlined_application)
+	{
+		mark_syntax_tree_dependencies(dependency_mask, tree->right, ledger);
+		return;
+	}
+	else if (tree->token.kind == TokenKind::identifier)
+	{
+		FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+		{
+			if
+			(
+				(it->type == StatementType::variable_declaration && it->tree->left->token.string       == tree->token.string) ||
+				(it->type == StatementType::function_declaration && it->tree->left->left->token.string == tree->token.string)
+			)
+			{
+				mark_statement_dependencies(dependency_mask, it, ledger);
+			}
+		}
+	}
+
+	mark_syntax_tree_dependencies(dependency_mask, tree->left , ledger);
+	mark_syntax_tree_dependencies(dependency_mask, tree->right, ledger);
+}
+
+internal void mark_statement_dependencies(u64* dependency_mask, Statement* statement, Ledger* ledger)
+{
+	u64 bit = 1ULL << (statement - ledger->statement_buffer);
+	if (*dependency_mask & bit)
+	{
+		return;
+	}
+	*dependency_mask |= bit;
+
+	switch (statement->type)
+	{
+		case StatementType::assertion:
+		{
+			mark_statement_dependencies(dependency_mask, statement->assertion.corresponding_statement, ledger);
+		} break;
+
+		case StatementType::expression:
+		{
+			mark_syntax_tree_dependencies(dependency_mask, statement->tree, ledger);
+		} break;
+
+		case StatementType::variable_declaration:
+		case StatementType::function_declaration:
+		{
+			mark_syntax_tree_dependencies(dependency_mask, statement->tree->right, ledger);
+		} break;
+	}
+}
+
+// @NOTE@ `names` is a comma-separated list of declaration names. Returns true on failure, leaving the unknown name in `unknown_name`.
+internal bool32 init_query_mask(u64* query_mask, StringView* unknown_name, Ledger* ledger, strlit names, bool32 includes_assertions)
+{
+	*query_mask = 0;
+
+	if (includes_assertions)
+	{
+		FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+		{
+			if (it->type == StatementType::assertion)
+			{
+				*query_mask |= 1ULL << it_index;
+			}
+		}
+	}
+
+	for (strlit name_start = names; name_start && *name_start;)
+	{
+		strlit name_end = name_start;
+		while (*name_end && *name_end != ',')
+		{
+			name_end += 1;
+		}
+
+		StringView name = { static_cast<i32>(name_end - name_start), name_start };
+		bool32     found = false;
+		FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+		{
+			if (it->type == StatementType::variable_declaration && it->tree->left->token.string == name)
+			{
+				*query_mask |= 1ULL << it_index;
+				found        = true;
+			}
+		}
+
+		if (!found)
+		{
+			*unknown_name = name;
+			return true;
+		}
+
+		name_start = *name_end ? name_end + 1 : name_end;
+	}
+
+	return false;
+}
+
+//
+// Column files.
+//
+
+// @NOTE@ The layout is described in `Meat_columns.h`. The file is written unbuffered: the header, descriptors and names in one write,
+// then every column straight from its own buffer.
+
+struct OutputColumn
+{
+	StringView name;
+	i32        value_count;
+	Number*    value_buffer;
+};
+
+global constexpr MeatColumnType OUTPUT_COLUMN_TYPE = sizeof(Number) == sizeof(f32) ? MEAT_COLUMN_TYPE_F32 : MEAT_COLUMN_TYPE_F64;
+
+internal constexpr memsize align_column_offset(memsize offset)
+{
+	return (offset + MEAT_COLUMNS_ALIGNMENT - 1) / MEAT_COLUMNS_ALIGNMENT * MEAT_COLUMNS_ALIGNMENT;
+}
+
+internal StringView get_output_column_name(Statement* statement, Ledger* ledger, MemoryArena* arena)
+{
+	if (statement->type == StatementType::variable_declaration)
+	{
+		return statement->tree->left->token.string;
+	}
+	else
+	{
+		return string_builder_quick(arena, "#%d", static_cast<i32>(statement - ledger->statement_buffer) + 1);
+	}
+}
+
+// @NOTE@ Returns true when the file could not be written.
+internal bool32 write_column_file(strlit file_path, OutputColumn* column_buffer, i32 column_count, i32 row_count, MemoryArena* arena)
+{
+	memory_arena_checkpoint(arena);
+
+	memsize prefix_size = sizeof(MeatColumnsHeader) + column_count * sizeof(MeatColumn);
+	FOR_ELEMS(it, column_buffer, column_count)
+	{
+		prefix_size += it->name.size;
+	}
+	prefix_size = align_column_offset(prefix_size);
+
+	byte*              prefix      = memory_arena_allocate_zero<byte>(arena, prefix_size);
+	MeatColumnsHeader* header      = reinterpret_cast<MeatColumnsHeader*>(prefix);
+	MeatColumn*        columns     = reinterpret_cast<MeatColumn*>(header + 1);
+	memsize            name_offset = sizeof(MeatColumnsHeader) + column_count * sizeof(MeatColumn);
+	memsize            data_offset = prefix_size;
+
+	FOR_ELEMS(it, column_buffer, column_count)
+	{
+		ASSERT(it->value_count == row_count || it->value_count == 1);
+
+		columns[it_index].data_offset = data_offset;
+		columns[it_index].type        = OUTPUT_COLUMN_TYPE;
+		columns[it_index].value_count = static_cast<u32>(it->value_count);
+		columns[it_index].name_offset = static_cast<u32>(name_offset);
+		columns[it_index].name_size   = static_cast<u32>(it->name.size);
+
+		memcpy(prefix + name_offset, it->name.data, it->name.size);
+		name_offset += it->name.size;
+		data_offset  = align_column_offset(data_offset + it->value_count * sizeof(Number));
+	}
+
+	header->magic        = MEAT_COLUMNS_MAGIC;
+	header->version      = MEAT_COLUMNS_VERSION;
+	header->column_count = static_cast<u32>(column_count);
+	header->row_count    = static_cast<u32>(row_count);
+	header->file_size    = data_offset;
+
+	FILE* file;
+	if (fopen_s(&file, file_path, "wb"))
+	{
+		return true;
+	}
+	DEFER { fclose(file); };
+	setvbuf(file, 0, _IONBF, 0);
+
+	if (fwrite(prefix, 1, prefix_size, file) != prefix_size)
+	{
+		return true;
+	}
+
+	persist constexpr byte PADDING[MEAT_COLUMNS_ALIGNMENT] = {};
+	FOR_ELEMS(it, column_buffer, column_count)
+	{
+		memsize size         = it->value_count * sizeof(Number);
+		memsize padding_size = align_column_offset(size) - size;
+		if (fwrite(it->value_buffer, sizeof(Number), it->value_count, file) != static_cast<memsize>(it->value_count) || fwrite(PADDING, 1, padding_size, file) != padding_size)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//
+// Sweeps.
+//
+
+// @NOTE@ A sweep table has a header naming the swept variables, then one row of values per configuration. Fields are separated by commas
+// or whitespace and rows by newlines. Every configuration gets its own copy of the statements, so workers share only the syntax trees,
+// and evaluation only reads those. Declarations that depend on no swept variable are evaluated once, before the copies are taken.
+
+global constexpr memsize SWEEP_SCRATCH_SIZE_PER_WORKER     = KIBIBYTES_OF(256);
+global constexpr memsize SWEEP_VALUE_ARENA_SIZE_PER_WORKER = KIBIBYTES_OF(128); // @NOTE@ Taken out of the scratch arena.
+global constexpr i32     SWEEP_GRANULARITY                 = 16;                // @NOTE@ Rows per job; a row is often only a handful of operations.
+
+struct SweepTable
+{
+	i32     swept_count;
+	i32     swept_statement_buffer[ARRAY_CAPACITY(Ledger, statement_buffer)];
+	i32     row_count;
+	Number* value_buffer; // @NOTE@ Row-major with `swept_count` values per row; from `malloc`.
+};
+
+struct InitSweepTableStatus
+{
+	StringView message;
+};
+
+internal constexpr bool32 is_sweep_separator(const char& c)
+{
+	return c == ',' || c == ' ' || c == '\t' || c == '\r';
+}
+
+// @NOTE@ Returns an empty field once the line at `*index` has no more, leaving `*index` on its newline.
+internal StringView eat_sweep_field(MappedFile* file, memsize* index)
+{
+	while (*index < file->size && is_sweep_separator(file->data[*index]))
+	{
+		*index += 1;
+	}
+
+	memsize start = *index;
+	while (*index < file->size && file->data[*index] != '\n' && !is_sweep_separator(file->data[*index]))
+	{
+		*index += 1;
+	}
+
+	return { static_cast<i32>(*index - start), reinterpret_cast<char*>(file->data) + start };
+}
+
+internal bool32 init_sweep_table(InitSweepTableStatus* status, SweepTable* table, Ledger* ledger, MemoryArena* arena, strlit file_path)
+{
+	MappedFile file;
+	if (init_mapped_file(&file, file_path))
+	{
+		status->message = string_builder_quick(arena, "You received an error in attempting to open the sweep table `%s`.", file_path);
+		return true;
+	}
+	DEFER { deinit_mapped_file(&file); };
+
+	i32 line_count = 1;
+	FOR_ELEMS(it, file.data, file.size)
+	{
+		line_count += *it == '\n';
+	}
+
+	table->swept_count  = 0;
+	table->row_count    = 0;
+	table->value_buffer = 0;
+
+	for (memsize index = 0; index < file.size; index += 1)
+	{
+		StringView field = eat_sweep_field(&file, &index);
+		if (!field.size)
+		{
+			continue; // @NOTE@ Blank line.
+		}
+
+		if (!table->swept_count)
+		{
+			for (; field.size; field = eat_sweep_field(&file, &index))
+			{
+				if (table->swept_count == ARRAY_CAPACITY(table->swept_statement_buffer))
+				{
+					status->message = string_builder_quick(arena, "The sweep table `%s` has too many columns.", file_path);
+					return true;
+				}
+
+				i32 statement_index = -1;
+				FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+				{
+					if (it->type == StatementType::variable_declaration && it->tree->left->token.string == field)
+					{
+						statement_index = it_index;
+					}
+				}
+
+				if (statement_index == -1)
+				{
+					status->message = string_builder_quick(arena, "I don't know the declaration `%.*s` swept by `%s`.", PASS_STRING_VIEW(field), file_path);
+					return true;
+				}
+
+				table->swept_statement_buffer[table->swept_count]  = statement_index;
+				table->swept_count                                += 1;
+			}
+
+			table->value_buffer = reinterpret_cast<Number*>(malloc(line_count * table->swept_count * sizeof(Number)));
+			continue;
+		}
+
+		Number* row    = table->value_buffer + table->row_count * table->swept_count;
+		i32     column = 0;
+		for (; field.size; field = eat_sweep_field(&file, &index))
+		{
+			if (column < table->swept_count)
+			{
+				char  buffer[64];
+				char* end = buffer;
+				if (field.size < ARRAY_CAPACITY(buffer))
+				{
+					sprintf_s(buffer, sizeof(buffer), "%.*s", PASS_STRING_VIEW(field));
+					row[column] = static_cast<Number>(sizeof(Number) == sizeof(f32) ? strtof(buffer, &end) : strtod(buffer, &end));
+				}
+
+				if (end == buffer || *end)
+				{
+					status->message = string_builder_quick(arena, "Row %d of the sweep table `%s` has the bad value `%.*s`.", table->row_count + 1, file_path, PASS_STRING_VIEW(field));
+					free(table->value_buffer);
+					return true;
+				}
+			}
+
+			column += 1;
+		}
+
+		if (column != table->swept_count)
+		{
+			status->message = string_builder_quick(arena, "Row %d of the sweep table `%s` has %d value(s) instead of %d.", table->row_count + 1, file_path, column, table->swept_count);
+			free(table->value_buffer);
+			return true;
+		}
+
+		table->row_count += 1;
+	}
+
+	if (!table->swept_count)
+	{
+		status->message = string_builder_quick(arena, "The sweep table `%s` is empty.", file_path);
+		return true;
+	}
+
+	return false;
+}
+
+internal void deinit_sweep_table(SweepTable* table)
+{
+	free(table->value_buffer);
+}
+
+struct Sweep
+{
+	Ledger*     ledger; // @NOTE@ Already holds the values of the shared declarations.
+	SweepTable* table;
+	i32         column_count;
+	i32         column_statement_buffer[ARRAY_CAPACITY(Ledger, statement_buffer)];
+	Number*     result_buffer; // @NOTE@ Column-major with `table->row_count` results per column.
+};
+
+internal void evaluate_sweep_rows(JobWorker* worker, i32 start, i32 end, void* data)
+{
+	Sweep* sweep = reinterpret_cast<Sweep*>(data);
+
+	// @NOTE@ Allocates from a copy of the scratch arena, so everything is dropped when the range is done. Arrays are dropped after every row.
+	Allocator allocator = {};
+	allocator.arena       = worker->scratch;
+	allocator.value_arena = memory_arena_reserve(&allocator.arena, SWEEP_VALUE_ARENA_SIZE_PER_WORKER);
+
+	Ledger* ledger = memory_arena_allocate<Ledger>(&allocator.arena);
+	*ledger                   = *sweep->ledger;
+	ledger->value_cache       = 0;
+	ledger->memo_epoch        = 0;
+	ledger->memo_value_buffer = memory_arena_allocate_zero<Value>(&allocator.arena, ledger->memo_count + 1);
+	ledger->memo_epoch_buffer = memory_arena_allocate_zero<u32>(&allocator.arena, ledger->memo_count + 1);
+	ledger->is_on_worker      = true;
+
+	FOR_RANGE(row, start, end)
+	{
+		memory_arena_checkpoint(&allocator.value_arena);
+		memcpy(ledger->statement_buffer, sweep->ledger->statement_buffer, sizeof(ledger->statement_buffer));
+		ledger->memo_epoch += 1;
+
+		FOR_RANGE(i, sweep->table->swept_count)
+		{
+			aliasing declaration = ledger->statement_buffer[sweep->table->swept_statement_buffer[i]].variable_declaration;
+			declaration.status            = VariableDeclarationStatus::cached;
+			declaration.cached_evaluation = box_number(sweep->table->value_buffer[row * sweep->table->swept_count + i]);
+		}
+
+		FOR_RANGE(column, sweep->column_count)
+		{
+			Statement* statement = &ledger->statement_buffer[sweep->column_statement_buffer[column]];
+			evaluate_statement(statement, ledger, &allocator);
+
+			sweep->result_buffer[column * sweep->table->row_count + row] =
+				get_value_number
+				(
+					statement->type == StatementType::variable_declaration
+						? statement->variable_declaration.cached_evaluation
+						: statement->expression.cached_evaluation
+				);
+		}
+	}
+
+	ASSERT(allocator.allocated_function_argument_node_count == 0);
+}
+
+// @NOTE@ Assertions are not checked, since a ledger's assertions are written against its own values, not the swept ones. With a column
+// file, the results are written there instead of printed. Returns true when the column file could not be written.
+internal bool32 sweep_ledger(Ledger* ledger, Allocator* allocator, SweepTable* table, strlit column_file_path)
+{
+	u64 swept_mask = 0;
+	FOR_RANGE(i, table->swept_count)
+	{
+		swept_mask |= 1ULL << table->swept_statement_buffer[i];
+	}
+
+	Sweep sweep        = {};
+	sweep.ledger       = ledger;
+	sweep.table        = table;
+	i32   shared_count = 0;
+
+	i32           shared_column_count  = 0;
+	OutputColumn* shared_column_buffer = memory_arena_allocate<OutputColumn>(&allocator->arena, ledger->statement_count);
+
+	FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+	{
+		if (it->type != StatementType::variable_declaration && it->type != StatementType::expression)
+		{
+			continue;
+		}
+
+		u64 dependency_mask = 0;
+		mark_statement_dependencies(&dependency_mask, it, ledger);
+
+		if (dependency_mask & swept_mask)
+		{
+			sweep.column_statement_buffer[sweep.column_count]  = it_index;
+			sweep.column_count                                += 1;
+		}
+		else
+		{
+			evaluate_statement(it, ledger, allocator);
+			shared_count += 1;
+
+			Value* value = it->type == StatementType::variable_declaration ? &it->variable_declaration.cached_evaluation : &it->expression.cached_evaluation;
+			if (is_scalar_value(*value)) // @NOTE@ Arrays are printed, but column files only hold numbers.
+			{
+				aliasing shared_column = shared_column_buffer[shared_column_count];
+				shared_column_count += 1;
+
+				shared_column.name            = get_output_column_name(it, ledger, &allocator->arena);
+				shared_column.value_count     = 1;
+				shared_column.value_buffer    = memory_arena_allocate<Number>(&allocator->arena);
+				shared_column.value_buffer[0] = get_value_number(*value);
+			}
+
+			output_string(STRING_VIEW_OF("Shared :: "));
+			output_value(*value);
+			output_string(STRING_VIEW_OF(" :: "));
+			DEBUG_print_serialized_syntax_tree(it->tree);
+			output_char('\n');
+		}
+	}
+
+	MemoryArena arena;
+	arena.size = ARRAY_CAPACITY(JobSystem, workers) * SWEEP_SCRATCH_SIZE_PER_WORKER;
+	arena.base = reinterpret_cast<byte*>(malloc(arena.size));
+	arena.used = 0;
+	DEFER { free(arena.base); };
+
+	sweep.result_buffer = reinterpret_cast<Number*>(malloc(table->row_count * sweep.column_count * sizeof(Number)));
+	DEFER { free(sweep.result_buffer); };
+
+	persist JobSystem job_system;
+	init_job_system(&job_system, &arena, 0, SWEEP_SCRATCH_SIZE_PER_WORKER);
+	job_parallel_for(&job_system.workers[0], table->row_count, SWEEP_GRANULARITY, evaluate_sweep_rows, &sweep);
+	i32 worker_count = job_system.worker_count;
+	deinit_job_system(&job_system);
+
+	if (column_file_path)
+	{
+		OutputColumn* column_buffer = memory_arena_allocate<OutputColumn>(&allocator->arena, shared_column_count + sweep.column_count);
+		memcpy(column_buffer, shared_column_buffer, shared_column_count * sizeof(OutputColumn));
+
+		FOR_RANGE(column, sweep.column_count)
+		{
+			aliasing output_column = column_buffer[shared_column_count + column];
+			output_column.name         = get_output_column_name(&ledger->statement_buffer[sweep.column_statement_buffer[column]], ledger, &allocator->arena);
+			output_column.value_count  = table->row_count;
+			output_column.value_buffer = sweep.result_buffer + column * table->row_count;
+		}
+
+		if (write_column_file(column_file_path, column_buffer, shared_column_count + sweep.column_count, table->row_count, &allocator->arena))
+		{
+			return true;
+		}
+
+		output_format("Sweep :: %d configuration(s) :: %d column(s) :: %d statement(s) shared :: %d worker(s) :: written to `%s`\n", table->row_count, sweep.column_count, shared_count, worker_count, column_file_path);
+		return false;
+	}
+
+	FOR_RANGE(column, sweep.column_count)
+	{
+		Statement* statement = &ledger->statement_buffer[sweep.column_statement_buffer[column]];
+		if (column)
+		{
+			output_char('\t');
+		}
+
+		if (statement->type == StatementType::variable_declaration)
+		{
+			output_string(statement->tree->left->token.string);
+		}
+		else
+		{
+			DEBUG_print_serialized_syntax_tree(statement->tree);
+		}
+	}
+	output_char('\n');
+
+	FOR_RANGE(row, table->row_count)
+	{
+		FOR_RANGE(column, sweep.column_count)
+		{
+			if (column)
+			{
+				output_char('\t');
+			}
+			output_number(sweep.result_buffer[column * table->row_count + row]);
+		}
+		output_char('\n');
+	}
+
+	output_format("Sweep :: %d configuration(s) :: %d column(s) :: %d statement(s) shared :: %d worker(s)\n", table->row_count, sweep.column_count, shared_count, worker_count);
+	return false;
+}
+
+//
+// Compilation.
+//
+
+// @NOTE@ Translates a parsed ledger into a C++ header that computes the same values natively. Variables, expression statements and
+// functions become `meat_` declarations emitted in dependency order. Ones that reach no built-in, `^` or `!` are `constexpr` and get
+// their assertions checked by `static_assert`. The rest are initialized at startup and their assertions are left to the generated
+// `meat_check_assertions`, which returns true on failure. The header expects `unified.h` and the built-ins of `predefined.cpp` to be
+// included before it, and computes in the precision of the build that generated it.
+
+global constexpr const char* COMPILED_NUMBER_TYPE   = sizeof(Number) == sizeof(f32) ? "f32"    : "f64";
+global constexpr const char* COMPILED_NUMBER_SUFFIX = sizeof(Number) == sizeof(f32) ? "f"      : "";
+global constexpr const char* COMPILED_POWER         = sizeof(Number) == sizeof(f32) ? "powf("  : "pow(";
+global constexpr const char* COMPILED_ABSOLUTE      = sizeof(Number) == sizeof(f32) ? "fabsf(" : "fabs(";
+
+enum struct CompilationStatus : u8
+{
+	yet_emitted,
+	currently_emitting,
+	emitted,
+};
+
+struct CompileLedgerStatus
+{
+	StringView message;
+};
+
+struct Compiler
+{
+	Ledger*           ledger;
+	MemoryArena*      arena;
+	StringView        message; // @NOTE@ The first error met; emitting carries on, but the header is not written.
+	StringBuilder     builder;
+	StringBuilder     runtime_assertion_builder;
+	CompilationStatus status_buffer      [ARRAY_CAPACITY(Ledger, statement_buffer)];
+	bool32            is_constexpr_buffer[ARRAY_CAPACITY(Ledger, statement_buffer)];
+};
+
+internal i32 find_compiled_statement(Compiler* compiler, StringView name, StatementType type)
+{
+	FOR_ELEMS(it, compiler->ledger->statement_buffer, compiler->ledger->statement_count)
+	{
+		if (it->type == type && type == StatementType::variable_declaration && it->tree->left->token.string == name)
+		{
+			return it_index;
+		}
+		else if (it->type == type && type == StatementType::function_declaration && it->tree->left->left->token.string == name)
+		{
+			return it_index;
+		}
+	}
+
+	return -1;
+}
+
+internal bool32 is_compiled_parameter(FunctionArgumentNode* parameters, StringView name)
+{
+	FOR_NODES(parameters)
+	{
+		if (it->name == name)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+internal void compile_statement(Compiler* compiler, i32 statement_index);
+
+// @NOTE@ Emits every declaration the tree refers to and returns whether the tree can be evaluated in a constant expression.
+internal bool32 compile_syntax_tree_dependencies(Compiler* compiler, SyntaxTree* tree, FunctionArgumentNode* parameters)
+{
+	if (!tree)
+	{
+		return true;
+	}
+	else if (tree->token.kind == TokenKind::inlined_application)
+	{
+		return compile_syntax_tree_dependencies(compiler, tree->right, parameters);
+	}
+
+	bool32 is_constexpr = tree->token.kind != TokenKind::caret && tree->token.kind != TokenKind::exclamation_point;
+
+	if (tree->token.kind == TokenKind::identifier && !is_compiled_parameter(parameters, tree->token.string) && !find_predefined_constant(tree->token.string))
+	{
+		i32 index = find_compiled_statement(compiler, tree->token.string, StatementType::variable_declaration);
+		if (index == -1)
+		{
+			if (!compiler->message.size)
+			{
+				compiler->message = string_builder_quick(compiler->arena, "`%.*s` is not defined.", PASS_STRING_VIEW(tree->token.string));
+			}
+			return false;
+		}
+
+		compile_statement(compiler, index);
+		is_constexpr = compiler->is_constexpr_buffer[index];
+	}
+	else if (tree->token.kind == TokenKind::parenthetical_application && tree->left && tree->left->token.kind == TokenKind::identifier)
+	{
+		if (find_predefined_function(tree->left->token.string))
+		{
+			compile_syntax_tree_dependencies(compiler, tree->right, parameters);
+			return false;
+		}
+
+		i32 index = find_compiled_statement(compiler, tree->left->token.string, StatementType::function_declaration);
+		if (index != -1)
+		{
+			compile_statement(compiler, index);
+			bool32 are_arguments_constexpr = compile_syntax_tree_dependencies(compiler, tree->right, parameters);
+			return compiler->is_constexpr_buffer[index] && are_arguments_constexpr;
+		}
+	}
+
+	bool32 is_left_constexpr  = compile_syntax_tree_dependencies(compiler, tree->left , parameters);
+	bool32 is_right_constexpr = compile_syntax_tree_dependencies(compiler, tree->right, parameters);
+	return is_constexpr && is_left_constexpr && is_right_constexpr;
+}
+
+// @NOTE@ Writes the literal into a buffer of at least 40 characters and returns its size.
+internal i32 format_compiled_number(char* buffer, Number value)
+{
+	if (isnan(value))
+	{
+		return sprintf_s(buffer, 40, "NAN");
+	}
+	else if (isinf(value))
+	{
+		return sprintf_s(buffer, 40, "%sINFINITY", value < 0.0f ? "-" : "");
+	}
+
+	i32    size        = sizeof(Number) == sizeof(f32) ? format_f32(buffer, static_cast<f32>(value)) : format_f64(buffer, static_cast<f64>(value));
+	bool32 is_integral = true;
+	FOR_ELEMS(c, buffer, size)
+	{
+		if (*c == '.' || *c == 'e')
+		{
+			is_integral = false;
+		}
+	}
+
+	return size + sprintf_s(buffer + size, 40 - size, "%s%s", is_integral ? ".0" : "", COMPILED_NUMBER_SUFFIX);
+}
+
+internal void compile_syntax_tree(StringBuilder* builder, SyntaxTree* tree, Compiler* compiler, FunctionArgumentNode* parameters)
+{
+	lambda compile_arguments =
+		[&](SyntaxTree* arguments)
+		{
+			for (SyntaxTree* current = arguments; current; current = current->token.kind == TokenKind::comma ? current->right : 0)
+			{
+				if (current != arguments)
+				{
+					string_builder_append(builder, STRING_VIEW_OF(", "));
+				}
+				compile_syntax_tree(builder, current->token.kind == TokenKind::comma ? current->left : current, compiler, parameters);
+			}
+		};
+
+	lambda compile_binary =
+		[&](StringView operation)
+		{
+			string_builder_append(builder, '(');
+			compile_syntax_tree(builder, tree->left, compiler, parameters);
+			string_builder_append(builder, operation);
+			compile_syntax_tree(builder, tree->right, compiler, parameters);
+			string_builder_append(builder, ')');
+		};
+
+	switch (tree->token.kind)
+	{
+		case TokenKind::identifier:
+		{
+			if (is_compiled_parameter(parameters, tree->token.string))
+			{
+				string_builder_append(builder, "arg_%.*s", PASS_STRING_VIEW(tree->token.string));
+			}
+			else if (find_predefined_constant(tree->token.string))
+			{
+				string_builder_append(builder, "constant_%.*s<%s>", PASS_STRING_VIEW(tree->token.string), COMPILED_NUMBER_TYPE);
+			}
+			else
+			{
+				string_builder_append(builder, "meat_%.*s", PASS_STRING_VIEW(tree->token.string));
+			}
+		} break;
+
+		case TokenKind::number:
+		{
+			char buffer[40];
+			string_builder_append(builder, { format_compiled_number(buffer, tree->number), buffer });
+		} break;
+
+		case TokenKind::plus         : { compile_binary(STRING_VIEW_OF(" + ")); } break;
+		case TokenKind::asterisk     : { compile_binary(STRING_VIEW_OF(" * ")); } break;
+		case TokenKind::forward_slash: { compile_binary(STRING_VIEW_OF(" / ")); } break;
+
+		case TokenKind::minus:
+		{
+			if (tree->left)
+			{
+				compile_binary(STRING_VIEW_OF(" - "));
+			}
+			else
+			{
+				string_builder_append(builder, STRING_VIEW_OF("(-"));
+				compile_syntax_tree(builder, tree->right, compiler, parameters);
+				string_builder_append(builder, ')');
+			}
+		} break;
+
+		case TokenKind::caret:
+		{
+			string_builder_append(builder, COMPILED_POWER);
+			compile_syntax_tree(builder, tree->left, compiler, parameters);
+			string_builder_append(builder, STRING_VIEW_OF(", "));
+			compile_syntax_tree(builder, tree->right, compiler, parameters);
+			string_builder_append(builder, ')');
+		} break;
+
+		case TokenKind::exclamation_point:
+		{
+			string_builder_append(builder, "static_cast<%s>(tgamma(", COMPILED_NUMBER_TYPE);
+			compile_syntax_tree(builder, tree->left, compiler, parameters);
+			string_builder_append(builder, STRING_VIEW_OF(" + 1.0))"));
+		} break;
+
+		case TokenKind::parenthetical_application:
+		{
+			if (!tree->left)
+			{
+				string_builder_append(builder, '(');
+				compile_syntax_tree(builder, tree->right, compiler, parameters);
+				string_builder_append(builder, ')');
+			}
+			else if (tree->left->token.kind == TokenKind::identifier && find_predefined_function(tree->left->token.string))
+			{
+				string_builder_append(builder, "function_%.*s<%s>(", PASS_STRING_VIEW(tree->left->token.string), COMPILED_NUMBER_TYPE);
+				compile_arguments(tree->right);
+				string_builder_append(builder, ')');
+			}
+			else if (tree->left->token.kind == TokenKind::identifier && find_compiled_statement(compiler, tree->left->token.string, StatementType::function_declaration) != -1)
+			{
+				string_builder_append(builder, "meat_%.*s(", PASS_STRING_VIEW(tree->left->token.string));
+				compile_arguments(tree->right);
+				string_builder_append(builder, ')');
+			}
+			else
+			{
+				compile_binary(STRING_VIEW_OF(" * "));
+			}
+		} break;
+
+		case TokenKind::inlined_application:
+		{
+			compile_syntax_tree(builder, tree->right, compiler, parameters);
+		} break;
+
+		default:
+		{
+			ASSERT(false); // Unknown token.
+		} break;
+	}
+}
+
+internal void compile_statement(Compiler* compiler, i32 statement_index)
+{
+	aliasing   status    = compiler->status_buffer[statement_index];
+	Statement* statement = &compiler->ledger->statement_buffer[statement_index];
+
+	if (status == CompilationStatus::emitted)
+	{
+		return;
+	}
+	else if (status == CompilationStatus::currently_emitting)
+	{
+		if (!compiler->message.size)
+		{
+			StringView name =
+				statement->type == StatementType::function_declaration
+					? statement->tree->left->left->token.string
+					: statement->tree->left->token.string;
+			compiler->message = string_builder_quick(compiler->arena, "`%.*s` is defined in terms of itself.", PASS_STRING_VIEW(name));
+		}
+		return;
+	}
+	status = CompilationStatus::currently_emitting;
+
+	aliasing is_constexpr = compiler->is_constexpr_buffer[statement_index];
+	switch (statement->type)
+	{
+		case StatementType::variable_declaration:
+		{
+			is_constexpr = compile_syntax_tree_dependencies(compiler, statement->tree->right, 0);
+			string_builder_append(&compiler->builder, "global %s %s meat_%.*s = ", is_constexpr ? "constexpr" : "const", COMPILED_NUMBER_TYPE, PASS_STRING_VIEW(statement->tree->left->token.string));
+			compile_syntax_tree(&compiler->builder, statement->tree->right, compiler, 0);
+			string_builder_append(&compiler->builder, STRING_VIEW_OF(";\n\n"));
+		} break;
+
+		case StatementType::expression:
+		{
+			is_constexpr = compile_syntax_tree_dependencies(compiler, statement->tree, 0);
+			string_builder_append(&compiler->builder, "global %s %s meat_statement_%d = ", is_constexpr ? "constexpr" : "const", COMPILED_NUMBER_TYPE, statement_index);
+			compile_syntax_tree(&compiler->builder, statement->tree, compiler, 0);
+			string_builder_append(&compiler->builder, STRING_VIEW_OF(";\n\n"));
+		} break;
+
+		case StatementType::function_declaration:
+		{
+			FunctionArgumentNode* parameters = statement->function_declaration.args;
+
+			is_constexpr = compile_syntax_tree_dependencies(compiler, statement->tree->right, parameters);
+			string_builder_append(&compiler->builder, "%s %s meat_%.*s(", is_constexpr ? "internal constexpr" : "internal", COMPILED_NUMBER_TYPE, PASS_STRING_VIEW(statement->tree->left->left->token.string));
+			FOR_NODES(parameters)
+			{
+				string_builder_append(&compiler->builder, "%s%s arg_%.*s", it == parameters ? "" : ", ", COMPILED_NUMBER_TYPE, PASS_STRING_VIEW(it->name));
+			}
+			string_builder_append(&compiler->builder, STRING_VIEW_OF(")\n{\n\treturn "));
+			compile_syntax_tree(&compiler->builder, statement->tree->right, compiler, parameters);
+			string_builder_append(&compiler->builder, STRING_VIEW_OF(";\n}\n\n"));
+		} break;
+
+		case StatementType::assertion:
+		{
+			i32 corresponding_index = static_cast<i32>(statement->assertion.corresponding_statement - compiler->ledger->statement_buffer);
+			compile_statement(compiler, corresponding_index);
+
+			Statement* corresponding = statement->assertion.corresponding_statement;
+			StringView name;
+			if (corresponding->type == StatementType::variable_declaration)
+			{
+				name = string_builder_quick(compiler->arena, "meat_%.*s", PASS_STRING_VIEW(corresponding->tree->left->token.string));
+			}
+			else
+			{
+				ASSERT(corresponding->type == StatementType::expression); // Unknown assertion case.
+				name = string_builder_quick(compiler->arena, "meat_statement_%d", corresponding_index);
+			}
+
+			char expected[40];
+			format_compiled_number(expected, statement->tree->right->number);
+
+			// @NOTE@ Same tolerance as the interpreter.
+			if (compiler->is_constexpr_buffer[corresponding_index])
+			{
+				string_builder_append
+				(
+					&compiler->builder,
+					"static_assert(%.*s - %s < 0.000001%s && %s - %.*s < 0.000001%s, \"Failed assertion :: %.*s\");\n\n",
+					PASS_STRING_VIEW(name), expected, COMPILED_NUMBER_SUFFIX, expected, PASS_STRING_VIEW(name), COMPILED_NUMBER_SUFFIX, PASS_STRING_VIEW(name)
+				);
+			}
+			else
+			{
+				string_builder_append
+				(
+					&compiler->runtime_assertion_builder,
+					"\tif (!(%s%.*s - %s) < 0.000001%s))\n\t{\n\t\treturn true;\n\t}\n",
+					COMPILED_ABSOLUTE, PASS_STRING_VIEW(name), expected, COMPILED_NUMBER_SUFFIX
+				);
+			}
+		} break;
+
+		default:
+		{
+			ASSERT(false); // Unknown statement type.
+		} break;
+	}
+
+	status = CompilationStatus::emitted;
+}
+
+// @NOTE@ Arrays have no counterpart in the generated header yet.
+internal bool32 has_array_syntax_tree(SyntaxTree* tree)
+{
+	return tree && (tree->token.kind == TokenKind::array || has_array_syntax_tree(tree->left) || has_array_syntax_tree(tree->right));
+}
+
+// @NOTE@ Neither do functionals.
+internal bool32 has_functional_syntax_tree(SyntaxTree* tree)
+{
+	return tree && ((tree->token.kind == TokenKind::identifier && find_functional(tree->token.string)) || has_functional_syntax_tree(tree->left) || has_functional_syntax_tree(tree->right));
+}
+
+// @NOTE@ Returns true when the ledger could not be compiled or the header could not be written. The message is allocated from `arena`.
+internal bool32 compile_ledger(CompileLedgerStatus* status, strlit file_path, Ledger* ledger, MemoryArena* arena)
+{
+	Compiler compiler = {};
+	compiler.ledger                    = ledger;
+	compiler.arena                     = arena;
+	compiler.builder                   = init_string_builder();
+	compiler.runtime_assertion_builder = init_string_builder();
+
+	string_builder_append
+	(
+		&compiler.builder,
+		STRING_VIEW_OF
+		(
+			"#pragma once\n"
+			"\n"
+			"// @NOTE@ Generated by `Meat -compile`. Expects `unified.h` and the built-ins of `predefined.cpp` to be included first.\n"
+			"\n"
+			"#include <math.h>\n"
+			"\n"
+		)
+	);
+
+	FOR_RANGE(i, ledger->statement_count)
+	{
+		compile_statement(&compiler, i);
+	}
+
+	if (compiler.message.size)
+	{
+		deinit_string_builder(&compiler.builder, arena);
+		deinit_string_builder(&compiler.runtime_assertion_builder, arena);
+		status->message = compiler.message;
+		return true;
+	}
+
+	string_builder_append(&compiler.builder, STRING_VIEW_OF("// @NOTE@ Checks the assertions that could not be checked at compile time. Returns true on failure.\n"));
+	string_builder_append(&compiler.builder, STRING_VIEW_OF("internal bool32 meat_check_assertions(void)\n{\n"));
+	StringView runtime_assertions = deinit_string_builder(&compiler.runtime_assertion_builder, arena);
+	string_builder_append(&compiler.builder, runtime_assertions);
+	string_builder_append(&compiler.builder, STRING_VIEW_OF("\treturn false;\n}\n"));
+
+	StringView header = deinit_string_builder(&compiler.builder, arena);
+	if (write_entire_file(file_path, header.data, header.size))
+	{
+		status->message = string_builder_quick(arena, "Couldn't write the compiled ledger to `%s`.", file_path);
+		return true;
+	}
+
+	return false;
+}
+
+//
+// Ledger image.
+//
+
+// @NOTE@ A ledger image is the parsed ledger laid out as [header][statements][syntax trees][function argument nodes][string pool].
+// Pointers are written as if the image were mapped at `LEDGER_IMAGE_BASE`. When the mapping lands there, the trees are used as is;
+// otherwise every pointer is shifted once. Token strings are interned into the string pool, and number literals keep their parsed value.
+
+global constexpr u64 LEDGER_IMAGE_MAGIC = 0x31474D495441454D; // "MEATIMG1"
+global constexpr u64 LEDGER_IMAGE_BASE  = 0x00005EA700000000;
+
+struct LedgerImageHeader
+{
+	u64 magic;
+	u64 source_hash;
+	u64 source_size;
+	u64 base;
+	u32 statement_size;
+	u32 syntax_tree_size;
+	u32 function_argument_node_size;
+	u32 number_size; // @NOTE@ Cached values are only meaningful to a build of the same precision.
+	i32 statement_count;
+	i32 syntax_tree_count;
+	i32 function_argument_node_count;
+	i32 string_pool_size;
+	i32 memo_count;
+	u64 statement_offset;
+	u64 syntax_tree_offset;
+	u64 function_argument_node_offset;
+	u64 string_pool_offset;
+};
+
+struct LedgerImageWriter
+{
+	byte*                 image;
+	SyntaxTree*           syntax_tree_buffer;
+	i32                   syntax_tree_count;
+	FunctionArgumentNode* function_argument_node_buffer;
+	i32                   function_argument_node_count;
+	char*                 string_pool;
+	i32                   string_pool_size;
+	i32                   interned_capacity;
+	StringView*           interned_buffer;
+	i32                   pushed_capacity;
+	SyntaxTree**          pushed_source_buffer; // @NOTE@ Shared nodes are written once; maps a ledger node to its image address.
+	SyntaxTree**          pushed_image_buffer;
+};
+
+internal u64 ledger_image_address(LedgerImageWriter* writer, const void* pointer)
+{
+	return pointer ? LEDGER_IMAGE_BASE + static_cast<u64>(reinterpret_cast<const byte*>(pointer) - writer->image) : 0;
+}
+
+internal StringView ledger_image_intern(LedgerImageWriter* writer, StringView string)
+{
+	i32 index = static_cast<i32>(hash_bytes(string) & (writer->interned_capacity - 1));
+	while (writer->interned_buffer[index].data && writer->interned_buffer[index] != string)
+	{
+		index = (index + 1) & (writer->interned_capacity - 1);
+	}
+
+	aliasing interned = writer->interned_buffer[index];
+	if (!interned.data)
+	{
+		memcpy(writer->string_pool + writer->string_pool_size, string.data, string.size);
+		interned                  = { string.size, writer->string_pool + writer->string_pool_size };
+		writer->string_pool_size += string.size;
+	}
+
+	return { interned.size, reinterpret_cast<const char*>(ledger_image_address(writer, interned.data)) };
+}
+
+internal i32 ledger_image_find_pushed(LedgerImageWriter* writer, SyntaxTree* tree)
+{
+	i32 index = static_cast<i32>(hash_mix(reinterpret_cast<u64>(tree), 0) & (writer->pushed_capacity - 1));
+	while (writer->pushed_source_buffer[index] && writer->pushed_source_buffer[index] != tree)
+	{
+		index = (index + 1) & (writer->pushed_capacity - 1);
+	}
+	return index;
+}
+
+internal void ledger_image_count_syntax_tree(LedgerImageWriter* writer, SyntaxTree* tree, i32* syntax_tree_count, i32* string_size)
+{
+	if (tree)
+	{
+		i32 index = ledger_image_find_pushed(writer, tree);
+		if (!writer->pushed_source_buffer[index])
+		{
+			writer->pushed_source_buffer[index]  = tree;
+			*syntax_tree_count                  += 1;
+			*string_size                        += tree->token.string.size;
+			ledger_image_count_syntax_tree(writer, tree->left , syntax_tree_count, string_size);
+			ledger_image_count_syntax_tree(writer, tree->right, syntax_tree_count, string_size);
+		}
+	}
+}
+
+internal SyntaxTree* ledger_image_push_syntax_tree(LedgerImageWriter* writer, SyntaxTree* tree)
+{
+	if (tree)
+	{
+		i32 index = ledger_image_find_pushed(writer, tree);
+		if (!writer->pushed_image_buffer[index])
+		{
+			SyntaxTree* node = &writer->syntax_tree_buffer[writer->syntax_tree_count];
+			writer->syntax_tree_count += 1;
+
+			*node              = *tree;
+			node->token.string = ledger_image_intern(writer, tree->token.string);
+			node->left         = ledger_image_push_syntax_tree(writer, tree->left );
+			node->right        = ledger_image_push_syntax_tree(writer, tree->right);
+
+			writer->pushed_image_buffer[index] = reinterpret_cast<SyntaxTree*>(ledger_image_address(writer, node));
+		}
+		return writer->pushed_image_buffer[index];
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+internal bool32 write_ledger_image(strlit file_path, Ledger* ledger, Allocator* allocator, u64 source_hash, u64 source_size)
+{
+	MemoryArena* arena = &allocator->arena;
+	memory_arena_checkpoint(arena);
+
+	LedgerImageWriter writer = {};
+	writer.pushed_capacity = 64;
+	while (writer.pushed_capacity < allocator->allocated_syntax_tree_count * 2)
+	{
+		writer.pushed_capacity *= 2;
+	}
+	writer.pushed_source_buffer = memory_arena_allocate_zero<SyntaxTree*>(arena, writer.pushed_capacity);
+	writer.pushed_image_buffer  = memory_arena_allocate_zero<SyntaxTree*>(arena, writer.pushed_capacity);
+
+	i32 syntax_tree_count            = 0;
+	i32 function_argument_node_count = 0;
+	i32 string_size                  = 0;
+	FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+	{
+		ledger_image_count_syntax_tree(&writer, it->tree, &syntax_tree_count, &string_size);
+
+		if (it->type == StatementType::function_declaration)
+		{
+			FOR_NODES(arg, it->function_declaration.args)
+			{
+				function_argument_node_count += 1;
+				string_size                  += arg->name.size;
+			}
+		}
+	}
+
+	LedgerImageHeader header = {};
+	header.magic                         = LEDGER_IMAGE_MAGIC;
+	header.source_hash                   = source_hash;
+	header.source_size                   = source_size;
+	header.base                          = LEDGER_IMAGE_BASE;
+	header.statement_size                = sizeof(Statement);
+	header.syntax_tree_size              = sizeof(SyntaxTree);
+	header.function_argument_node_size   = sizeof(FunctionArgumentNode);
+	header.number_size                   = sizeof(Number);
+	header.statement_count               = ledger->statement_count;
+	header.syntax_tree_count             = syntax_tree_count;
+	header.function_argument_node_count  = function_argument_node_count;
+	header.memo_count                    = ledger->memo_count;
+	header.statement_offset              = sizeof(LedgerImageHeader);
+	header.syntax_tree_offset            = header.statement_offset              + sizeof(Statement)            * header.statement_count;
+	header.function_argument_node_offset = header.syntax_tree_offset            + sizeof(SyntaxTree)           * header.syntax_tree_count;
+	header.string_pool_offset            = header.function_argument_node_offset + sizeof(FunctionArgumentNode) * header.function_argument_node_count;
+
+	writer.image                         = memory_arena_allocate_zero<byte>(arena, header.string_pool_offset + string_size);
+	writer.syntax_tree_buffer            = reinterpret_cast<SyntaxTree*          >(writer.image + header.syntax_tree_offset           );
+	writer.function_argument_node_buffer = reinterpret_cast<FunctionArgumentNode*>(writer.image + header.function_argument_node_offset);
+	writer.string_pool                   = reinterpret_cast<char*                >(writer.image + header.string_pool_offset           );
+	writer.interned_capacity             = 64;
+	while (writer.interned_capacity < (syntax_tree_count + function_argument_node_count) * 2)
+	{
+		writer.interned_capacity *= 2;
+	}
+	writer.interned_buffer = memory_arena_allocate_zero<StringView>(arena, writer.interned_capacity);
+
+	Statement* statement_buffer = reinterpret_cast<Statement*>(writer.image + header.statement_offset);
+	FOR_ELEMS(it, ledger->statement_buffer, ledger->statement_count)
+	{
+		aliasing statement = statement_buffer[it_index];
+		statement.type = it->type;
+		statement.tree = ledger_image_push_syntax_tree(&writer, it->tree);
+
+		if (it->type == StatementType::function_declaration)
+		{
+			FunctionArgumentNode** args_nil = &statement.function_declaration.args;
+			FOR_NODES(arg, it->function_declaration.args)
+			{
+				FunctionArgumentNode* node = &writer.function_argument_node_buffer[writer.function_argument_node_count];
+				writer.function_argument_node_count += 1;
+
+				node->name = ledger_image_intern(&writer, arg->name);
+				*args_nil  = reinterpret_cast<FunctionArgumentNode*>(ledger_image_address(&writer, node));
+				args_nil   = &node->next_node;
+			}
+		}
+	}
+
+	header.string_pool_size = writer.string_pool_size;
+	*reinterpret_cast<LedgerImageHeader*>(writer.image) = header;
+
+	return write_entire_file(file_path, writer.image, header.string_pool_offset + header.string_pool_size);
+}
+
+template <typename TYPE>
+internal TYPE* ledger_image_relocate(TYPE* pointer, i64 delta)
+{
+	return pointer ? reinterpret_cast<TYPE*>(reinterpret_cast<u64>(pointer) + delta) : 0;
+}
+
+// @NOTE@ Whether `address`, as written in the image, is null or the start of one of the `count` items of `size` bytes at `offset`.
+internal bool32 is_ledger_image_item(LedgerImageHeader* header, const void* address, u64 offset, u64 size, i32 count)
+{
+	u64 start    = header->base + offset;
+	u64 position = reinterpret_cast<u64>(address);
+	return !address || (position >= start && position - start < size * count && (position - start) % size == 0);
+}
+
+internal bool32 is_ledger_image_string(LedgerImageHeader* header, StringView string)
+{
+	u64 start    = header->base + header->string_pool_offset;
+	u64 position = reinterpret_cast<u64>(string.data);
+	return
+		string.size >= 0 &&
+		(
+			!string.size ||
+			(position >= start && position - start <= static_cast<u64>(header->string_pool_size) && static_cast<u64>(string.size) <= header->string_pool_size - (position - start))
+		);
+}
+
+// @NOTE@ Checks everything the loader trusts before anything is relocated: the sections must be laid out back to back as the writer lays
+// them out, every pointer must be the start of an item of its own section, and every string must lie within the string pool.
+internal bool32 is_ledger_image_valid(LedgerImageHeader* header)
+{
+	if
+	(
+		header->syntax_tree_count             <  0                                                                                                           ||
+		header->function_argument_node_count  <  0                                                                                                           ||
+		header->string_pool_size              <  0                                                                                                           ||
+		header->statement_offset              != sizeof(LedgerImageHeader)                                                                                   ||
+		header->syntax_tree_offset            != header->statement_offset              + sizeof(Statement)            * header->statement_count              ||
+		header->function_argument_node_offset != header->syntax_tree_offset            + sizeof(SyntaxTree)           * header->syntax_tree_count            ||
+		header->string_pool_offset            != header->function_argument_node_offset + sizeof(FunctionArgumentNode) * header->function_argument_node_count ||
+		!IN_RANGE(header->memo_count, 0, header->syntax_tree_count + 1)
+	)
+	{
+		return false;
+	}
+
+	byte* image = reinterpret_cast<byte*>(header);
 
-					default:
-					{
-						ASSERT(false); // Unknown token.
-					} break;
-				}
-			}
-		} break;
+	FOR_ELEMS(it, reinterpret_cast<SyntaxTree*>(image + header->syntax_tree_offset), header->syntax_tree_count)
+	{
+		if
+		(
+			!is_ledger_image_item(header, it->left , header->syntax_tree_offset, sizeof(SyntaxTree), header->syntax_tree_count) ||
+			!is_ledger_image_item(header, it->right, header->syntax_tree_offset, sizeof(SyntaxTree), header->syntax_tree_count) ||
+			!is_ledger_image_string(header, it->token.string)                                                                   ||
+			it->token.kind > TokenKind::array                                                                                   ||
+			!IN_RANGE(it->memo_index, 0, header->memo_count + 1)
+		)
+		{
+			return false;
+		}
+	}
 
-		case StatementType::variable_declaration:
+	FOR_ELEMS(it, reinterpret_cast<FunctionArgumentNode*>(image + header->function_argument_node_offset), header->function_argument_node_count)
+	{
+		if
+		(
+			!is_ledger_image_item(header, it->next_node, header->function_argument_node_offset, sizeof(FunctionArgumentNode), header->function_argument_node_count) ||
+			!is_ledger_image_string(header, it->name)
+		)
 		{
-			switch (statement->variable_declaration.status)
-			{
-				case VariableDeclarationStatus::yet_calculated:
-				{
-					statement->variable_declaration.status            = VariableDeclarationStatus::currently_calculating;
-					statement->variable_declaration.cached_evaluation = evaluate_expression(statement->tree->right);
-					statement->variable_declaration.status            = VariableDeclarationStatus::cached;
-				} break;
+			return false;
+		}
+	}
 
-				case VariableDeclarationStatus::currently_calculating:
-				{
-					ASSERT(false); // Circlar definition.
-				} break;
+	FOR_ELEMS(it, reinterpret_cast<Statement*>(image + header->statement_offset), header->statement_count)
+	{
+		if
+		(
+			!it->tree                                                                                                          ||
+			!is_ledger_image_item(header, it->tree, header->syntax_tree_offset, sizeof(SyntaxTree), header->syntax_tree_count) ||
+			it->type < StatementType::assertion                                                                                ||
+			it->type > StatementType::function_declaration
+		)
+		{
+			return false;
+		}
+		else if (it->type == StatementType::assertion && (!it_index || (it - 1)->type == StatementType::assertion || (it - 1)->type == StatementType::function_declaration))
+		{
+			return false;
+		}
+		else if
+		(
+			it->type == StatementType::function_declaration &&
+			!is_ledger_image_item(header, it->function_declaration.args, header->function_argument_node_offset, sizeof(FunctionArgumentNode), header->function_argument_node_count)
+		)
+		{
+			return false;
+		}
+	}
 
-				case VariableDeclarationStatus::cached:
-				{
-				} break;
+	return true;
+}
 
-				default:
-				{
-					ASSERT(false); // Unknown variable declaration status.
-				} break;
-			};
-		} break;
+// @NOTE@ Fails if the image is missing, was made from a different source, was written by a build with different layouts, or is malformed.
+internal bool32 init_ledger_from_image(Ledger* ledger, MappedFile* image_file, strlit file_path, u64 source_hash, u64 source_size)
+{
+	if (init_mapped_file(image_file, file_path, true, reinterpret_cast<void*>(LEDGER_IMAGE_BASE)))
+	{
+		return true;
+	}
 
-		case StatementType::function_declaration:
+	LedgerImageHeader* header = reinterpret_cast<LedgerImageHeader*>(image_file->data);
+	if
+	(
+		image_file->size < sizeof(LedgerImageHeader)                                ||
+		header->magic                       != LEDGER_IMAGE_MAGIC                   ||
+		header->source_hash                 != source_hash                          ||
+		header->source_size                 != source_size                          ||
+		header->statement_size              != sizeof(Statement)                    ||
+		header->syntax_tree_size            != sizeof(SyntaxTree)                   ||
+		header->function_argument_node_size != sizeof(FunctionArgumentNode)         ||
+		header->number_size                 != sizeof(Number)                       ||
+		!IN_RANGE(header->statement_count, 0, ARRAY_CAPACITY(ledger->statement_buffer) + 1) ||
+		header->string_pool_offset + header->string_pool_size != image_file->size           ||
+		!is_ledger_image_valid(header)
+	)
+	{
+		deinit_mapped_file(image_file);
+		return true;
+	}
+
+	i64 delta = static_cast<i64>(reinterpret_cast<u64>(image_file->data) - header->base);
+	if (delta)
+	{
+		FOR_ELEMS(it, reinterpret_cast<SyntaxTree*>(image_file->data + header->syntax_tree_offset), header->syntax_tree_count)
 		{
-		} break;
+			it->left              = ledger_image_relocate(it->left , delta);
+			it->right             = ledger_image_relocate(it->right, delta);
+			it->token.string.data = ledger_image_relocate(it->token.string.data, delta);
+		}
 
-		default:
+		FOR_ELEMS(it, reinterpret_cast<FunctionArgumentNode*>(image_file->data + header->function_argument_node_offset), header->function_argument_node_count)
 		{
-			ASSERT(false); // Unknown statement type.
-		} break;
+			it->next_node = ledger_image_relocate(it->next_node, delta);
+			it->name.data = ledger_image_relocate(it->name.data, delta);
+		}
 	}
+
+	ledger->memo_count      = header->memo_count;
+	ledger->statement_count = header->statement_count;
+	FOR_ELEMS(it, reinterpret_cast<Statement*>(image_file->data + header->statement_offset), header->statement_count)
+	{
+		aliasing statement = ledger->statement_buffer[it_index];
+		statement      = {}; // @NOTE@ Nothing but the type, tree and parameters is written, so nothing else is read.
+		statement.type = it->type;
+		statement.tree = ledger_image_relocate(it->tree, delta);
+
+		if (statement.type == StatementType::assertion)
+		{
+			statement.assertion.corresponding_statement = &ledger->statement_buffer[it_index - 1];
+		}
+		else if (statement.type == StatementType::function_declaration)
+		{
+			statement.function_declaration.args = ledger_image_relocate(it->function_declaration.args, delta);
+		}
+	}
+
+	return false;
 }
 
-int main(void)
+// @NOTE@ `Meat_library.cpp` includes this file for everything but the command line.
+#if !MEAT_LIBRARY
+int main(int argc, char** argv)
 {
 	DEFER { DEBUG_STDOUT_HALT(); };
 
+	output_builder = init_string_builder();
+	DEFER { flush_output(); };
+	#if DEBUG
+	DEBUG_assert_callback = flush_output;
+	#endif
+
 	//
-	// Initialization.
+	// Arguments.
 	//
 
-	Ledger ledger = {};
+	strlit ledger_file_path = DATA_DIR "meat.meat";
+	bool32 use_ledger_image = false;
+	bool32 use_value_cache  = false;
+	bool32 use_hash_consing = false;
+	i32    inline_threshold = 0;
+	bool32 is_querying      = false;
+	strlit query_names      = 0;
+	bool32 query_assertions = false;
+	bool32 is_quiet         = false;
+	strlit compile_path     = 0;
+	strlit sweep_path       = 0;
+	strlit column_file_path = 0;
+	bool32 is_exact         = false;
+
+	FOR_RANGE(i, 1, argc)
+	{
+		if (strcmp(argv[i], "-image") == 0)
+		{
+			use_ledger_image = true;
+		}
+		else if (strcmp(argv[i], "-values") == 0)
+		{
+			use_value_cache = true;
+		}
+		else if (strcmp(argv[i], "-cse") == 0)
+		{
+			use_hash_consing = true;
+		}
+		else if (strcmp(argv[i], "-inline") == 0)
+		{
+			inline_threshold = INLINE_DEFAULT_THRESHOLD;
+		}
+		else if (strncmp(argv[i], "-inline=", 8) == 0)
+		{
+			char* end;
+			long  threshold = strtol(argv[i] + 8, &end, 10);
+			if (end == argv[i] + 8 || *end || !IN_RANGE(threshold, 0, INT32_MAX))
+			{
+				output_format("The flag `%s` takes a whole number of at least zero.\n", argv[i]);
+				return -1;
+			}
+			inline_threshold = static_cast<i32>(threshold);
+		}
+		else if (strncmp(argv[i], "-query=", 7) == 0)
+		{
+			is_querying = true;
+			query_names = argv[i] + 7;
+		}
+		else if (strcmp(argv[i], "-asserts") == 0)
+		{
+			is_querying      = true;
+			query_assertions = true;
+		}
+		else if (strcmp(argv[i], "-quiet") == 0)
+		{
+			is_quiet = true;
+		}
+		else if (strncmp(argv[i], "-compile=", 9) == 0)
+		{
+			compile_path = argv[i] + 9;
+		}
+		else if (strncmp(argv[i], "-sweep=", 7) == 0)
+		{
+			sweep_path = argv[i] + 7;
+		}
+		else if (strncmp(argv[i], "-columns=", 9) == 0)
+		{
+			column_file_path = argv[i] + 9;
+		}
+		else if (strcmp(argv[i], "-exact") == 0)
+		{
+			is_exact = true;
+		}
+		else if (argv[i][0] == '-')
+		{
+			output_format("I don't know the flag `%s`.\n", argv[i]);
+			return -1;
+		}
+		else
+		{
+			ledger_file_path = argv[i];
+		}
+	}
+
+	//
+	// Initialization.
+	//
 
-	Allocator allocator  = {};
-	allocator.arena.size = MEBIBYTES_OF(1);
-	allocator.arena.base = reinterpret_cast<byte*>(malloc(allocator.arena.size));
-	allocator.arena.used = 0;
+	Ledger     ledger               = {};
+	MappedFile ledger_image         = {};
+	bool32     is_ledger_from_image = false;
+
+	Allocator allocator        = {};
+	allocator.arena.size       = MEBIBYTES_OF(1);
+	allocator.arena.base       = reinterpret_cast<byte*>(malloc(allocator.arena.size));
+	allocator.arena.used       = 0;
+	allocator.value_arena.size = MEBIBYTES_OF(16);
+	allocator.value_arena.base = reinterpret_cast<byte*>(malloc(allocator.value_arena.size));
+	allocator.value_arena.used = 0;
 	DEFER
 	{
 		// @NOTE@ Makes sure every initialization has been deinitialized.
-		FOR_ELEMS(it, ledger.statement_buffer, ledger.statement_count)
+		if (is_ledger_from_image)
 		{
-			deinit_entire_syntax_tree(&allocator, it->tree);
-
-			if (it->type == StatementType::function_declaration)
+			deinit_mapped_file(&ledger_image);
+		}
+		else
+		{
+			FOR_ELEMS(it, ledger.statement_buffer, ledger.statement_count)
 			{
-				deinit_entire_function_argument_node(&allocator, it->function_declaration.args);
+				deinit_entire_syntax_tree(&allocator, it->tree);
+
+				if (it->type == StatementType::function_declaration)
+				{
+					deinit_entire_function_argument_node(&allocator, it->function_declaration.args);
+				}
 			}
 		}
 
-		ASSERT(allocator.allocated_token_buffer_node_count      == 0);
-		ASSERT(allocator.allocated_syntax_tree_count            == 0);
-		ASSERT(allocator.allocated_function_argument_node_count == 0);
+		ASSERT(allocator.allocated_token_buffer_node_count        == 0);
+		ASSERT(allocator.allocated_syntax_tree_count              == 0);
+		ASSERT(allocator.allocated_function_argument_node_count   == 0);
+		ASSERT(allocator.allocated_parser_frame_buffer_node_count == 0);
 
 		free(allocator.arena.base);
+		free(allocator.value_arena.base);
 	};
 
-	Tokenizer tokenizer;
+	char ledger_image_file_path[1024];
+	u64  source_hash = 0;
+	u64  source_size = 0;
+	if (use_ledger_image)
+	{
+		sprintf_s(ledger_image_file_path, sizeof(ledger_image_file_path), "%s.image", ledger_file_path);
+
+		MappedFile source;
+		if (!init_mapped_file(&source, ledger_file_path))
+		{
+			source_hash = hash_bytes(source.data, source.size);
+			source_size = source.size;
+			deinit_mapped_file(&source);
+
+			is_ledger_from_image = !init_ledger_from_image(&ledger, &ledger_image, ledger_image_file_path, source_hash, source_size);
+		}
+	}
+
+	// @NOTE@ A ledger loaded from its image leaves the tokenizer empty, so the parsing loop below is skipped.
+	Tokenizer tokenizer = {};
+	if (!is_ledger_from_image)
 	{
 		InitTokenizerStatus status;
-		if (init_tokenizer(&status, &tokenizer, &allocator, DATA_DIR "meat.meat"))
+		if (init_tokenizer(&status, &tokenizer, &allocator, ledger_file_path))
 		{
-			printf("%.*s\n", PASS_STRING_VIEW(status.message));
+			output_format("%.*s\n", PASS_STRING_VIEW(status.message));
 			return -1;
 		}
 	}
-	DEFER { deinit_tokenizer(&allocator, &tokenizer); };
+	DEFER
+	{
+		if (!is_ledger_from_image)
+		{
+			deinit_tokenizer(&allocator, &tokenizer);
+		}
+	};
 
 	//
 	// Interpreting.
@@ -1144,76 +5797,165 @@ int main(void)
 
 	while (peek_token(&tokenizer).kind != TokenKind::eof)
 	{
-		ASSERT(IN_RANGE(ledger.statement_count, 0, ARRAY_CAPACITY(ledger.statement_buffer)));
-		aliasing statement = ledger.statement_buffer[ledger.statement_count];
-		ledger.statement_count += 1;
+		Statement*         statement;
+		EatStatementStatus status;
+		if (eat_statement(&status, &statement, &tokenizer, &ledger, &allocator))
+		{
+			output_format("%.*s\n", PASS_STRING_VIEW(status.message));
+			return -1;
+		}
+
+		SyntaxTree* mismatch = find_arity_mismatch(statement->tree);
+		if (mismatch)
+		{
+			output_format
+			(
+				"`%.*s` takes %d argument(s) but was given %d.\n",
+				PASS_STRING_VIEW(mismatch->left->token.string),
+				get_builtin_arity(mismatch->left->token.string),
+				count_application_arguments(mismatch)
+			);
+			return -1;
+		}
 
-		statement = {};
-		statement.tree = eat_syntax_tree(&tokenizer, &ledger, &allocator);
-		ASSERT(statement.tree);
+		if (!is_quiet)
+		{
+			DEBUG_print_syntax_tree(statement->tree);
+			output_string(STRING_VIEW_OF("===================\n"));
+		}
+	}
 
-		if (statement.tree->token.kind == TokenKind::assertion)
+	{
+		CheckLedgerStatus status;
+		if (check_ledger(&status, &ledger, &allocator))
 		{
-			ASSERT(IN_RANGE(ledger.statement_count - 2, 0, ledger.statement_count));
-			statement.type                              = StatementType::assertion;
-			statement.assertion.corresponding_statement = &ledger.statement_buffer[ledger.statement_count - 2];
+			output_format("%.*s\n", PASS_STRING_VIEW(status.message));
+			return -1;
 		}
-		else if (statement.tree->token.kind == TokenKind::equal)
+	}
+
+	if (compile_path)
+	{
+		FOR_ELEMS(it, ledger.statement_buffer, ledger.statement_count)
 		{
-			if (statement.tree->left->token.kind == TokenKind::parenthetical_application)
+			if (has_array_syntax_tree(it->tree))
 			{
-				ASSERT(statement.tree->left->left);
-				ASSERT(statement.tree->left->left->token.kind == TokenKind::identifier);
-				ASSERT(!is_name_defined(statement.tree->left->left->token.string, &ledger));
+				output_format("Ledgers with arrays can't be compiled yet.\n");
+				return -1;
+			}
 
-				statement.type = StatementType::function_declaration;
+			if (has_functional_syntax_tree(it->tree))
+			{
+				output_format("Ledgers with functionals can't be compiled yet.\n");
+				return -1;
+			}
+		}
 
-				FunctionArgumentNode** args_nil = &statement.function_declaration.args;
-				for (SyntaxTree* tree = statement.tree->left->right; tree; tree = tree->right)
-				{
-					if (tree->token.kind == TokenKind::comma)
-					{
-						ASSERT(tree->left->token.kind == TokenKind::identifier);
-						*args_nil = init_function_argument_node(&allocator, tree->left->token.string);
-					}
-					else
-					{
-						ASSERT(tree->token.kind == TokenKind::identifier);
-						*args_nil = init_function_argument_node(&allocator, tree->token.string);
-						break;
-					}
+		CompileLedgerStatus status;
+		if (compile_ledger(&status, compile_path, &ledger, &allocator.arena))
+		{
+			output_format("%.*s\n", PASS_STRING_VIEW(status.message));
+			return -1;
+		}
 
-					args_nil  = &(*args_nil)->next_node;
-				}
-			}
-			else
-			{
-				// @TODO@ `x = x` is not noticed as ill-formed.
+		output_format("Compiled `%s` into `%s`.\n", ledger_file_path, compile_path);
+		return 0;
+	}
 
-				ASSERT(statement.tree->left->token.kind == TokenKind::identifier);
-				ASSERT(!statement.tree->left->left);
-				ASSERT(!statement.tree->left->right);
-				ASSERT(!is_name_defined(statement.tree->left->token.string, &ledger));
+	if (inline_threshold && !is_ledger_from_image)
+	{
+		Inliner inliner;
+		inline_ledger(&inliner, &ledger, &allocator, inline_threshold);
 
-				statement.type = StatementType::variable_declaration;
+		i32 inlined_count = 0;
+		FOR_ELEMS(it, ledger.statement_buffer, ledger.statement_count)
+		{
+			i32 count = inliner.inlined_count_buffer[it_index];
+			if (count)
+			{
+				output_format("Inlined `%.*s` at %d call site(s).\n", PASS_STRING_VIEW(it->tree->left->left->token.string), count);
+				inlined_count += count;
 			}
 		}
-		else
+		output_format("Inlining :: %d call(s) inlined :: threshold of %d node(s)\n", inlined_count, inline_threshold);
+	}
+
+	if (use_hash_consing && !is_ledger_from_image)
+	{
+		HashConsReport report;
+		hash_cons_ledger(&report, &ledger, &allocator);
+		output_format("Hash-consing :: %d of %d node(s) deduplicated :: %d shared node(s) memoized\n", report.deduplicated_count, report.node_count, report.memoized_count);
+	}
+	init_ledger_memo(&ledger, &allocator.arena);
+	ledger.is_exact = is_exact;
+
+	if (use_ledger_image)
+	{
+		if (is_ledger_from_image)
+		{
+			output_format("Loaded the ledger image `%s`.\n", ledger_image_file_path);
+		}
+		else if (write_ledger_image(ledger_image_file_path, &ledger, &allocator, source_hash, source_size))
+		{
+			output_format("You received an error in attempting to write the ledger image `%s`.\n", ledger_image_file_path);
+		}
+	}
+
+	if (sweep_path)
+	{
+		SweepTable           table;
+		InitSweepTableStatus status;
+		if (init_sweep_table(&status, &table, &ledger, &allocator.arena, sweep_path))
+		{
+			output_format("%.*s\n", PASS_STRING_VIEW(status.message));
+			return -1;
+		}
+		DEFER { deinit_sweep_table(&table); };
+
+		if (sweep_ledger(&ledger, &allocator, &table, column_file_path))
 		{
-			statement.type = StatementType::expression;
+			output_format("You received an error in attempting to write the column file `%s`.\n", column_file_path);
+			return -1;
 		}
+		return 0;
+	}
 
-		Token terminating_token = eat_token(&tokenizer);
-		ASSERT(terminating_token.kind == TokenKind::semicolon);
+	char       value_cache_file_path[1024];
+	ValueCache value_cache;
+	if (use_value_cache)
+	{
+		sprintf_s(value_cache_file_path, sizeof(value_cache_file_path), "%s.values", ledger_file_path);
+		init_value_cache(&value_cache, &ledger, &allocator.arena, value_cache_file_path);
+	}
 
-		DEBUG_print_syntax_tree(statement.tree);
-		printf("===================\n");
+	u64 query_mask = ~0ULL;
+	if (is_querying)
+	{
+		StringView unknown_name;
+		if (init_query_mask(&query_mask, &unknown_name, &ledger, query_names, query_assertions))
+		{
+			output_format("I don't know the declaration `%.*s`.\n", PASS_STRING_VIEW(unknown_name));
+			return -1;
+		}
 	}
 
 	FOR_ELEMS(it, ledger.statement_buffer, ledger.statement_count)
 	{
+		if (!(query_mask & (1ULL << it_index)))
+		{
+			continue;
+		}
+
 		evaluate_statement(it, &ledger, &allocator);
 
+		if (allocator.evaluation_error)
+		{
+			output_format("%.*s :: ", PASS_STRING_VIEW(*allocator.evaluation_error));
+			DEBUG_print_serialized_syntax_tree(it->tree);
+			output_char('\n');
+			return -1;
+		}
+
 		switch (it->type)
 		{
 			case StatementType::assertion:
@@ -1223,17 +5965,19 @@ int main(void)
 			case StatementType::variable_declaration:
 			{
 				ASSERT(it->variable_declaration.status == VariableDeclarationStatus::cached);
-				printf("%f :: ", it->variable_declaration.cached_evaluation);
+				output_value(it->variable_declaration.cached_evaluation);
+				output_string(STRING_VIEW_OF(" :: "));
 				DEBUG_print_serialized_syntax_tree(it->tree);
-				printf("\n");
+				output_char('\n');
 			} break;
 
 			case StatementType::expression:
 			{
 				ASSERT(it->expression.is_cached);
-				printf("%f :: ", it->expression.cached_evaluation);
+				output_value(it->expression.cached_evaluation);
+				output_string(STRING_VIEW_OF(" :: "));
 				DEBUG_print_serialized_syntax_tree(it->tree);
-				printf("\n");
+				output_char('\n');
 			} break;
 
 			case StatementType::function_declaration:
@@ -1247,13 +5991,71 @@ int main(void)
 		}
 	}
 
+	if (column_file_path)
+	{
+		i32           column_count  = 0;
+		OutputColumn* column_buffer = memory_arena_allocate<OutputColumn>(&allocator.arena, ledger.statement_count);
+		FOR_ELEMS(it, ledger.statement_buffer, ledger.statement_count)
+		{
+			if ((query_mask & (1ULL << it_index)) && (it->type == StatementType::variable_declaration || it->type == StatementType::expression))
+			{
+				Value* value = it->type == StatementType::variable_declaration ? &it->variable_declaration.cached_evaluation : &it->expression.cached_evaluation;
+				if (!is_scalar_value(*value)) // @NOTE@ Column files only hold numbers.
+				{
+					continue;
+				}
+
+				aliasing column = column_buffer[column_count];
+				column_count += 1;
+
+				column.name            = get_output_column_name(it, &ledger, &allocator.arena);
+				column.value_count     = 1;
+				column.value_buffer    = memory_arena_allocate<Number>(&allocator.arena);
+				column.value_buffer[0] = get_value_number(*value);
+			}
+		}
+
+		if (write_column_file(column_file_path, column_buffer, column_count, 1, &allocator.arena))
+		{
+			output_format("You received an error in attempting to write the column file `%s`.\n", column_file_path);
+		}
+	}
+
+	if (is_querying)
+	{
+		u64 dependency_mask = 0;
+		FOR_ELEMS(it, ledger.statement_buffer, ledger.statement_count)
+		{
+			if (query_mask & (1ULL << it_index))
+			{
+				mark_statement_dependencies(&dependency_mask, it, &ledger);
+			}
+		}
+
+		i32 dependency_count = 0;
+		FOR_RANGE(i, ledger.statement_count)
+		{
+			dependency_count += (dependency_mask >> i) & 1;
+		}
+		output_format("Query :: %d of %d statement(s) skipped\n", ledger.statement_count - dependency_count, ledger.statement_count);
+	}
+
+	if (use_value_cache)
+	{
+		output_format("Value cache :: %d hit(s) :: %d miss(es)\n", value_cache.hit_count, value_cache.miss_count);
+		if (write_value_cache(value_cache_file_path, &ledger, &allocator.arena))
+		{
+			output_format("You received an error in attempting to write the value cache `%s`.\n", value_cache_file_path);
+		}
+	}
+
 	#if 0
 	FOR_NODES(node, tokenizer.head_token_buffer_node)
 	{
-		printf(":: Token buffer node\n");
+		output_format(":: Token buffer node\n");
 		FOR_ELEMS(it, node->buffer, node->count)
 		{
-			printf("Token : `%.*s`\n", PASS_STRING_VIEW(it->string));
+			output_format("Token : `%.*s`\n", PASS_STRING_VIEW(it->string));
 		}
 	}
 	#elif 0
@@ -1267,10 +6069,11 @@ int main(void)
 		}
 		else
 		{
-			printf("Token : `%.*s`\n", PASS_STRING_VIEW(token.string));
+			output_format("Token : `%.*s`\n", PASS_STRING_VIEW(token.string));
 		}
 	}
 	#endif
 
 	return 0;
 }
+#endif
@@ -0,0 +1,120 @@
+#pragma once
+
+// @NOTE@ A column file holds named arrays of results that can be mapped and read in place, so nothing is formatted or parsed. It is laid
+// out as [header][column descriptors][names][column data]. Every array starts on a 64-byte boundary and every number is little-endian.
+// Variable declarations are named after the variable; expression statements are named `#N` after their position in the ledger, counting
+// from one. A sweep stores the values shared by every configuration as columns holding a single value.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define MEAT_COLUMNS_MAGIC     0x4C4F434D // "MCOL"
+#define MEAT_COLUMNS_VERSION   1
+#define MEAT_COLUMNS_ALIGNMENT 64
+
+// @NOTE@ Every column of a file has the same type, which is the precision of the Meat build that wrote it.
+enum MeatColumnType : uint32_t
+{
+	MEAT_COLUMN_TYPE_F32 = 1,
+	MEAT_COLUMN_TYPE_F64 = 2,
+};
+
+struct MeatColumnsHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t column_count;
+	uint32_t row_count;
+	uint64_t file_size;
+};
+
+struct MeatColumn
+{
+	uint64_t data_offset;
+	uint32_t type;
+	uint32_t value_count; // @NOTE@ Either `row_count`, or one for a value shared by every row.
+	uint32_t name_offset;
+	uint32_t name_size;
+};
+
+static inline const MeatColumn* meat_columns_get(const MeatColumnsHeader* header, int index)
+{
+	return reinterpret_cast<const MeatColumn*>(header + 1) + index;
+}
+
+// @NOTE@ Returns zero for an unknown type.
+static inline size_t meat_columns_get_value_size(uint32_t type)
+{
+	return type == MEAT_COLUMN_TYPE_F32 ? sizeof(float) : type == MEAT_COLUMN_TYPE_F64 ? sizeof(double) : 0;
+}
+
+// @NOTE@ Returns the header when all `size` bytes at `data` make up a whole column file, and null otherwise. The data must be at least
+// 8-byte aligned, which a mapped view always is.
+static inline const MeatColumnsHeader* meat_columns_open(const void* data, size_t size)
+{
+	const MeatColumnsHeader* header = reinterpret_cast<const MeatColumnsHeader*>(data);
+	if
+	(
+		size              <  sizeof(MeatColumnsHeader) ||
+		header->magic     != MEAT_COLUMNS_MAGIC        ||
+		header->version   != MEAT_COLUMNS_VERSION      ||
+		header->file_size != size                      ||
+		sizeof(MeatColumnsHeader) + static_cast<uint64_t>(header->column_count) * sizeof(MeatColumn) > size
+	)
+	{
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < header->column_count; i += 1)
+	{
+		const MeatColumn* column = meat_columns_get(header, static_cast<int>(i));
+		if
+		(
+			!meat_columns_get_value_size(column->type)                                                                          ||
+			(column->value_count != header->row_count && column->value_count != 1)                                              ||
+			column->data_offset % MEAT_COLUMNS_ALIGNMENT                                                                        ||
+			column->data_offset > size                                                                                          ||
+			static_cast<uint64_t>(column->value_count) * meat_columns_get_value_size(column->type) > size - column->data_offset ||
+			static_cast<uint64_t>(column->name_offset) + column->name_size > size
+		)
+		{
+			return 0;
+		}
+	}
+
+	return header;
+}
+
+static inline const char* meat_columns_get_name(const MeatColumnsHeader* header, const MeatColumn* column, int* name_size)
+{
+	*name_size = static_cast<int>(column->name_size);
+	return reinterpret_cast<const char*>(header) + column->name_offset;
+}
+
+// @NOTE@ Points into the file itself; there are `value_count` values. Returns null when the column is of the other type.
+static inline const float* meat_columns_get_f32(const MeatColumnsHeader* header, const MeatColumn* column)
+{
+	return column->type == MEAT_COLUMN_TYPE_F32 ? reinterpret_cast<const float*>(reinterpret_cast<const char*>(header) + column->data_offset) : 0;
+}
+
+static inline const double* meat_columns_get_f64(const MeatColumnsHeader* header, const MeatColumn* column)
+{
+	return column->type == MEAT_COLUMN_TYPE_F64 ? reinterpret_cast<const double*>(reinterpret_cast<const char*>(header) + column->data_offset) : 0;
+}
+
+// @NOTE@ Returns -1 when there is no column of that name.
+static inline int meat_columns_find(const MeatColumnsHeader* header, const char* name)
+{
+	size_t name_size = strlen(name);
+	for (uint32_t i = 0; i < header->column_count; i += 1)
+	{
+		const MeatColumn* column = meat_columns_get(header, static_cast<int>(i));
+		if (column->name_size == name_size && memcmp(reinterpret_cast<const char*>(header) + column->name_offset, name, name_size) == 0)
+		{
+			return static_cast<int>(i);
+		}
+	}
+
+	return -1;
+}
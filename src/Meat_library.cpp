@@ -0,0 +1,249 @@
+#define MEAT_LIBRARY 1
+#include "Meat.cpp"
+#include "Meat_library.h"
+
+struct MeatHandle
+{
+	Ledger    ledger;
+	Allocator allocator;
+	Tokenizer tokenizer;
+	bool32    is_stale; // @NOTE@ Set when the bindings changed since the last evaluation.
+	i32       slot_count;
+	i32       slot_statement_buffer[ARRAY_CAPACITY(Ledger, statement_buffer)];
+	bool8     is_bound_buffer      [ARRAY_CAPACITY(Ledger, statement_buffer)];
+	Number    bound_value_buffer   [ARRAY_CAPACITY(Ledger, statement_buffer)];
+};
+
+// @NOTE@ Forgets everything computed under the previous bindings. Memoized subexpressions are forgotten at once by bumping the epoch.
+internal void refresh_meat_handle(MeatHandle* handle)
+{
+	if (!handle->is_stale)
+	{
+		return;
+	}
+
+	handle->allocator.value_arena.used = 0;
+	handle->allocator.evaluation_error = 0;
+
+	FOR_ELEMS(it, handle->ledger.statement_buffer, handle->ledger.statement_count)
+	{
+		if (it->type == StatementType::variable_declaration)
+		{
+			it->variable_declaration.status = VariableDeclarationStatus::yet_calculated;
+		}
+		else if (it->type == StatementType::expression)
+		{
+			it->expression.is_cached = false;
+		}
+	}
+
+	FOR_RANGE(slot, handle->slot_count)
+	{
+		if (handle->is_bound_buffer[slot])
+		{
+			aliasing declaration = handle->ledger.statement_buffer[handle->slot_statement_buffer[slot]].variable_declaration;
+			declaration.status            = VariableDeclarationStatus::cached;
+			declaration.cached_evaluation = box_number(handle->bound_value_buffer[slot]);
+		}
+	}
+
+	handle->ledger.memo_epoch += 1;
+	handle->is_stale           = false;
+}
+
+extern "C" MeatHandle* meat_compile(const char* source, int source_size, char* error_buffer, int error_capacity)
+{
+	MeatHandle* handle = reinterpret_cast<MeatHandle*>(malloc(sizeof(MeatHandle)));
+	*handle = {};
+
+	handle->allocator.arena.size       = MEBIBYTES_OF(1);
+	handle->allocator.arena.base       = reinterpret_cast<byte*>(malloc(handle->allocator.arena.size));
+	handle->allocator.arena.used       = 0;
+	handle->allocator.value_arena.size = MEBIBYTES_OF(4);
+	handle->allocator.value_arena.base = reinterpret_cast<byte*>(malloc(handle->allocator.value_arena.size));
+	handle->allocator.value_arena.used = 0;
+
+	char* file_data = reinterpret_cast<char*>(malloc(source_size));
+	memcpy(file_data, source, source_size);
+
+	InitTokenizerStatus status;
+	if (init_tokenizer(&status, &handle->tokenizer, &handle->allocator, file_data, source_size))
+	{
+		if (error_buffer)
+		{
+			snprintf(error_buffer, error_capacity, "%.*s", PASS_STRING_VIEW(status.message));
+		}
+
+		free(handle->allocator.arena.base);
+		free(handle->allocator.value_arena.base);
+		free(handle);
+		return 0;
+	}
+
+	while (peek_token(&handle->tokenizer).kind != TokenKind::eof)
+	{
+		Statement*         statement;
+		EatStatementStatus eat_status;
+		if (eat_statement(&eat_status, &statement, &handle->tokenizer, &handle->ledger, &handle->allocator))
+		{
+			if (error_buffer)
+			{
+				snprintf(error_buffer, error_capacity, "%.*s", PASS_STRING_VIEW(eat_status.message));
+			}
+
+			meat_free(handle);
+			return 0;
+		}
+
+		SyntaxTree* mismatch = find_arity_mismatch(statement->tree);
+		if (mismatch)
+		{
+			if (error_buffer)
+			{
+				snprintf
+				(
+					error_buffer,
+					error_capacity,
+					"`%.*s` takes %d argument(s) but was given %d.",
+					PASS_STRING_VIEW(mismatch->left->token.string),
+					get_builtin_arity(mismatch->left->token.string),
+					count_application_arguments(mismatch)
+				);
+			}
+
+			meat_free(handle);
+			return 0;
+		}
+
+		if (statement->type == StatementType::variable_declaration)
+		{
+			handle->slot_statement_buffer[handle->slot_count]  = handle->ledger.statement_count - 1;
+			handle->slot_count                                += 1;
+		}
+	}
+
+	CheckLedgerStatus check_status;
+	if (check_ledger(&check_status, &handle->ledger, &handle->allocator))
+	{
+		if (error_buffer)
+		{
+			snprintf(error_buffer, error_capacity, "%.*s", PASS_STRING_VIEW(check_status.message));
+		}
+
+		meat_free(handle);
+		return 0;
+	}
+
+	HashConsReport report;
+	hash_cons_ledger(&report, &handle->ledger, &handle->allocator);
+	init_ledger_memo(&handle->ledger, &handle->allocator.arena);
+
+	return handle;
+}
+
+extern "C" void meat_free(MeatHandle* handle)
+{
+	FOR_ELEMS(it, handle->ledger.statement_buffer, handle->ledger.statement_count)
+	{
+		deinit_entire_syntax_tree(&handle->allocator, it->tree);
+
+		if (it->type == StatementType::function_declaration)
+		{
+			deinit_entire_function_argument_node(&handle->allocator, it->function_declaration.args);
+		}
+	}
+	deinit_tokenizer(&handle->allocator, &handle->tokenizer);
+
+	ASSERT(handle->allocator.allocated_token_buffer_node_count        == 0);
+	ASSERT(handle->allocator.allocated_syntax_tree_count              == 0);
+	ASSERT(handle->allocator.allocated_function_argument_node_count   == 0);
+	ASSERT(handle->allocator.allocated_parser_frame_buffer_node_count == 0);
+
+	free(handle->allocator.arena.base);
+	free(handle->allocator.value_arena.base);
+	free(handle);
+}
+
+extern "C" int meat_get_slot_count(MeatHandle* handle)
+{
+	return handle->slot_count;
+}
+
+extern "C" int meat_find_slot(MeatHandle* handle, const char* name)
+{
+	StringView name_string = { static_cast<i32>(strlen(name)), name };
+	FOR_RANGE(slot, handle->slot_count)
+	{
+		if (handle->ledger.statement_buffer[handle->slot_statement_buffer[slot]].tree->left->token.string == name_string)
+		{
+			return slot;
+		}
+	}
+
+	return -1;
+}
+
+extern "C" const char* meat_get_slot_name(MeatHandle* handle, int slot, int* name_size)
+{
+	ASSERT(IN_RANGE(slot, 0, handle->slot_count));
+	StringView name = handle->ledger.statement_buffer[handle->slot_statement_buffer[slot]].tree->left->token.string;
+	*name_size = name.size;
+	return name.data;
+}
+
+extern "C" void meat_bind_f64(MeatHandle* handle, int slot, double value)
+{
+	ASSERT(IN_RANGE(slot, 0, handle->slot_count));
+	handle->is_bound_buffer   [slot] = true;
+	handle->bound_value_buffer[slot] = static_cast<Number>(value);
+	handle->is_stale                 = true;
+}
+
+extern "C" void meat_bind(MeatHandle* handle, int slot, float value)
+{
+	meat_bind_f64(handle, slot, value);
+}
+
+extern "C" void meat_unbind(MeatHandle* handle, int slot)
+{
+	ASSERT(IN_RANGE(slot, 0, handle->slot_count));
+	handle->is_bound_buffer[slot] = false;
+	handle->is_stale              = true;
+}
+
+extern "C" double meat_evaluate_f64(MeatHandle* handle, int slot)
+{
+	ASSERT(IN_RANGE(slot, 0, handle->slot_count));
+	refresh_meat_handle(handle);
+
+	Statement* statement = &handle->ledger.statement_buffer[handle->slot_statement_buffer[slot]];
+	evaluate_statement(statement, &handle->ledger, &handle->allocator);
+	return get_value_number(statement->variable_declaration.cached_evaluation);
+}
+
+extern "C" int meat_get_evaluation_error(MeatHandle* handle, char* error_buffer, int error_capacity)
+{
+	if (!handle->allocator.evaluation_error)
+	{
+		return false;
+	}
+
+	if (error_buffer)
+	{
+		snprintf(error_buffer, error_capacity, "%.*s", PASS_STRING_VIEW(*handle->allocator.evaluation_error));
+	}
+	return true;
+}
+
+extern "C" float meat_evaluate(MeatHandle* handle, int slot)
+{
+	return static_cast<float>(meat_evaluate_f64(handle, slot));
+}
+
+extern "C" void meat_evaluate_all(MeatHandle* handle, float* value_buffer)
+{
+	FOR_RANGE(slot, handle->slot_count)
+	{
+		value_buffer[slot] = meat_evaluate(handle, slot);
+	}
+}
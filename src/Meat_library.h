@@ -0,0 +1,32 @@
+#pragma once
+
+// @NOTE@ Compile a ledger once, then evaluate it any number of times with different bindings. A slot names one variable declaration of
+// the ledger, in the order they are declared. Binding a slot overrides the declaration's own expression until it is unbound. Every
+// handle owns its memory, so there can be any number of them, but a handle must only be used by one thread at a time. Evaluation does
+// not allocate; it only draws from memory the handle reserved when it was compiled. Values are computed in the precision the library
+// was built with; the `float` entry points round to it and from it, and the `_f64` ones lose nothing under a 64-bit or mixed build.
+
+struct MeatHandle;
+
+extern "C"
+{
+	// @NOTE@ Returns null on failure, with the reason written to `error_buffer` when one is given.
+	MeatHandle* meat_compile(const char* source, int source_size, char* error_buffer, int error_capacity);
+	void        meat_free(MeatHandle* handle);
+
+	int         meat_get_slot_count(MeatHandle* handle);
+	int         meat_find_slot(MeatHandle* handle, const char* name); // @NOTE@ Returns -1 when there is no such variable.
+	const char* meat_get_slot_name(MeatHandle* handle, int slot, int* name_size);
+
+	void        meat_bind(MeatHandle* handle, int slot, float value);
+	void        meat_bind_f64(MeatHandle* handle, int slot, double value);
+	void        meat_unbind(MeatHandle* handle, int slot);
+
+	float       meat_evaluate(MeatHandle* handle, int slot); // @NOTE@ Returns NaN for arrays.
+	double      meat_evaluate_f64(MeatHandle* handle, int slot);
+	void        meat_evaluate_all(MeatHandle* handle, float* value_buffer); // @NOTE@ Writes one value per slot.
+
+	// @NOTE@ A value that met an error, such as arrays of different lengths, evaluates to NaN. Returns nonzero when any value evaluated
+	// under the current bindings did, with the first error written to `error_buffer` when one is given.
+	int         meat_get_evaluation_error(MeatHandle* handle, char* error_buffer, int error_capacity);
+}
@@ -0,0 +1,484 @@
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "Meat_library.cpp"
+
+internal f64 benchmark_seconds(void)
+{
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return static_cast<f64>(counter.QuadPart) / static_cast<f64>(frequency.QuadPart);
+}
+
+//
+// Job system.
+//
+
+internal void benchmark_empty_job(JobWorker*, void*)
+{
+}
+
+internal void benchmark_empty_range(JobWorker*, i32, i32, void*)
+{
+}
+
+internal void benchmark_heavy_range(JobWorker*, i32 start, i32 end, void* data)
+{
+	f32* results = reinterpret_cast<f32*>(data);
+	FOR_RANGE(i, start, end)
+	{
+		f32 x = static_cast<f32>(i);
+		FOR_RANGE(256)
+		{
+			x = sinf(x) * 0.5f + cosf(x * 0.25f);
+		}
+		results[i] = x;
+	}
+}
+
+internal void benchmark_job_system(MemoryArena* arena)
+{
+	constexpr i32 JOB_COUNT       = 1 << 18;
+	constexpr i32 HEAVY_COUNT     = 1 << 14;
+	constexpr i32 EMPTY_FOR_COUNT = 1 << 20;
+
+	printf("Job system :: %u hardware threads\n", std::thread::hardware_concurrency());
+
+	{
+		JobFunction* volatile function = benchmark_empty_job;
+		f64                   start    = benchmark_seconds();
+		FOR_RANGE(JOB_COUNT)
+		{
+			function(0, 0);
+		}
+		printf("\tdirect call          :: %8.2f ns/job\n", (benchmark_seconds() - start) / JOB_COUNT * 1e9);
+	}
+
+	f32* results = memory_arena_allocate<f32>(arena, HEAVY_COUNT);
+	f64  serial_heavy_time = 0.0;
+
+	for (i32 worker_count = 1; worker_count <= static_cast<i32>(std::thread::hardware_concurrency()) && worker_count <= 64; worker_count *= 2)
+	{
+		memory_arena_checkpoint(arena);
+
+		persist JobSystem system;
+		init_job_system(&system, arena, worker_count, KIBIBYTES_OF(64));
+		DEFER { deinit_job_system(&system); };
+		JobWorker* worker = &system.workers[0];
+
+		printf("\t%d worker(s)\n", system.worker_count);
+
+		{
+			Job jobs[256];
+			f64 start = benchmark_seconds();
+			for (i32 i = 0; i < JOB_COUNT; i += ARRAY_CAPACITY(jobs))
+			{
+				JobCounter counter = {};
+				FOR_ELEMS(job, jobs)
+				{
+					*job = { benchmark_empty_job, 0, &counter };
+					job_fork(worker, job);
+				}
+				job_wait(worker, &counter);
+			}
+			printf("\t\tfork/join            :: %8.2f ns/job\n", (benchmark_seconds() - start) / JOB_COUNT * 1e9);
+		}
+
+		{
+			f64 start = benchmark_seconds();
+			job_parallel_for(worker, EMPTY_FOR_COUNT, 1, benchmark_empty_range, 0);
+			printf("\t\tparallel-for (g = 1) :: %8.2f ns/iteration\n", (benchmark_seconds() - start) / EMPTY_FOR_COUNT * 1e9);
+		}
+
+		{
+			f64 start = benchmark_seconds();
+			job_parallel_for(worker, HEAVY_COUNT, 64, benchmark_heavy_range, results);
+			f64 elapsed = benchmark_seconds() - start;
+			if (worker_count == 1)
+			{
+				serial_heavy_time = elapsed;
+			}
+			printf("\t\tparallel-for (heavy) :: %8.3f ms :: %.2fx\n", elapsed * 1e3, serial_heavy_time / elapsed);
+		}
+	}
+}
+
+//
+// Perfect hashing.
+//
+
+internal void benchmark_perfect_hash(MemoryArena* arena)
+{
+	constexpr i32 LOOKUP_COUNT = 1 << 20;
+
+	printf("Perfect hashing :: %d lookups per measurement\n", LOOKUP_COUNT);
+
+	for (i32 name_count = 10; name_count <= 1000; name_count *= 10)
+	{
+		memory_arena_checkpoint(arena);
+
+		StringView* name_buffer = memory_arena_allocate<StringView>(arena, name_count);
+		u64*        hash_buffer = memory_arena_allocate<u64>(arena, name_count);
+		FOR_RANGE(i, name_count)
+		{
+			char* data = memory_arena_allocate<char>(arena, 16);
+			name_buffer[i] = { snprintf(data, 16, "function_%d", i), data };
+			hash_buffer[i] = hash_bytes(name_buffer[i]);
+		}
+
+		i32         bucket_count        = get_perfect_hash_bucket_count(name_count);
+		u32*        displacement_buffer = memory_arena_allocate<u32>(arena, bucket_count);
+		i32*        slot_buffer         = memory_arena_allocate<i32>(arena, name_count);
+		StringView* table               = memory_arena_allocate<StringView>(arena, name_count);
+
+		f64 build_start = benchmark_seconds();
+		if (init_perfect_hash(displacement_buffer, bucket_count, slot_buffer, hash_buffer, name_count, arena))
+		{
+			printf("\t%4d names :: failed to build the perfect hash\n", name_count);
+			continue;
+		}
+		f64 build_time = benchmark_seconds() - build_start;
+
+		FOR_RANGE(i, name_count)
+		{
+			table[slot_buffer[i]] = name_buffer[i];
+		}
+
+		// @NOTE@ The queried names are copies picked ahead of time, so both lookups see the same sequence and have to compare the bytes.
+		StringView* query_buffer = memory_arena_allocate<StringView>(arena, LOOKUP_COUNT);
+		StringView* copy_buffer  = memory_arena_allocate<StringView>(arena, name_count);
+		FOR_RANGE(i, name_count)
+		{
+			char* data = memory_arena_allocate<char>(arena, name_buffer[i].size);
+			memcpy(data, name_buffer[i].data, name_buffer[i].size);
+			copy_buffer[i] = { name_buffer[i].size, data };
+		}
+		u32 state = 0x9E3779B9;
+		FOR_ELEMS(it, query_buffer, LOOKUP_COUNT)
+		{
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			*it    = copy_buffer[state % static_cast<u32>(name_count)];
+		}
+
+		i32 linear_found_count = 0;
+		f64 linear_start       = benchmark_seconds();
+		FOR_ELEMS(query, query_buffer, LOOKUP_COUNT)
+		{
+			FOR_ELEMS(it, name_buffer, name_count)
+			{
+				if (*it == *query)
+				{
+					linear_found_count += 1;
+					break;
+				}
+			}
+		}
+		f64 linear_time = benchmark_seconds() - linear_start;
+
+		i32 perfect_found_count = 0;
+		f64 perfect_start       = benchmark_seconds();
+		FOR_ELEMS(query, query_buffer, LOOKUP_COUNT)
+		{
+			i32 slot = get_perfect_hash_slot(displacement_buffer, bucket_count, name_count, hash_bytes(*query));
+			if (table[slot] == *query)
+			{
+				perfect_found_count += 1;
+			}
+		}
+		f64 perfect_time = benchmark_seconds() - perfect_start;
+
+		if (linear_found_count != LOOKUP_COUNT || perfect_found_count != LOOKUP_COUNT)
+		{
+			printf("\t%4d names :: %d and %d of %d lookups found\n", name_count, linear_found_count, perfect_found_count, LOOKUP_COUNT);
+			continue;
+		}
+
+		printf("\t%4d names :: build %8.3f ms :: linear scan %8.2f ns/lookup :: perfect hash %8.2f ns/lookup :: %.2fx\n", name_count, build_time * 1e3, linear_time / LOOKUP_COUNT * 1e9, perfect_time / LOOKUP_COUNT * 1e9, linear_time / perfect_time);
+	}
+}
+
+//
+// Values.
+//
+
+// @NOTE@ Evaluates the same degree-8 polynomial by Horner's rule over the same inputs: in a plain `Number`, with the operators the
+// interpreter applies to numbers and to arrays, and then as a ledger through the library. The operators must agree with the plain
+// `Number` to the bit, and so must arrays unless the build is mixed and their elements are narrower.
+internal void benchmark_values(MemoryArena* arena)
+{
+	constexpr i32 INPUT_COUNT      = 1 << 16;
+	constexpr i32 DEGREE           = 8;
+	constexpr i32 ROUND_COUNT      = 16;
+	constexpr i32 ARRAY_COUNT      = 4;
+	constexpr i32 EVALUATION_COUNT = 1 << 18;
+
+	f64 operation_count = static_cast<f64>(INPUT_COUNT) * DEGREE * 2 * ROUND_COUNT;
+	printf("Values :: %d bytes :: %.0f operations per measurement\n", static_cast<i32>(sizeof(Value)), operation_count);
+
+	memory_arena_checkpoint(arena);
+
+	Number  coefficient_buffer[DEGREE + 1];
+	Number* raw_buffer   = memory_arena_allocate<Number>(arena, INPUT_COUNT);
+	Value*  boxed_buffer = memory_arena_allocate<Value >(arena, INPUT_COUNT);
+	FOR_ELEMS(it, coefficient_buffer)
+	{
+		*it = 1 / static_cast<Number>(it_index + 1);
+	}
+	FOR_RANGE(i, INPUT_COUNT)
+	{
+		raw_buffer  [i] = static_cast<Number>(i) / INPUT_COUNT;
+		boxed_buffer[i] = box_number(raw_buffer[i]);
+	}
+
+	f64 raw_checksum = 0.0;
+	f64 raw_start    = benchmark_seconds();
+	FOR_RANGE(ROUND_COUNT)
+	{
+		FOR_RANGE(i, INPUT_COUNT)
+		{
+			Number result = coefficient_buffer[0];
+			FOR_RANGE(k, 1, DEGREE + 1)
+			{
+				result = result * raw_buffer[i] + coefficient_buffer[k];
+			}
+			raw_checksum += result;
+		}
+	}
+	f64 raw_time = benchmark_seconds() - raw_start;
+
+	f64 number_checksum = 0.0;
+	f64 number_start    = benchmark_seconds();
+	FOR_RANGE(ROUND_COUNT)
+	{
+		FOR_RANGE(i, INPUT_COUNT)
+		{
+			Value result = box_number(coefficient_buffer[0]);
+			FOR_RANGE(k, 1, DEGREE + 1)
+			{
+				result = apply_binary_operator<ArrayMultiplication>(0, result, boxed_buffer[i]);
+				result = apply_binary_operator<ArrayAddition>(0, result, box_number(coefficient_buffer[k]));
+			}
+			number_checksum += unbox_number(result);
+		}
+	}
+	f64 number_time = benchmark_seconds() - number_start;
+
+	// @NOTE@ Arrays go through the handler table. Their elements come from a value arena that is reset after every polynomial.
+	Allocator allocator = {};
+	allocator.value_arena.size = KIBIBYTES_OF(64);
+	allocator.value_arena.base = memory_arena_allocate<byte>(arena, allocator.value_arena.size);
+
+	ValueArray* input_array = init_value_array(&allocator, ARRAY_COUNT);
+	memsize     array_used  = allocator.value_arena.used;
+
+	f64 array_checksum = 0.0;
+	f64 array_start    = benchmark_seconds();
+	FOR_RANGE(ROUND_COUNT)
+	{
+		for (i32 i = 0; i < INPUT_COUNT; i += ARRAY_COUNT)
+		{
+			FOR_ELEMS(it, input_array->elements, ARRAY_COUNT)
+			{
+				*it = static_cast<Element>(raw_buffer[i + it_index]);
+			}
+
+			Value result = box_number(coefficient_buffer[0]);
+			FOR_RANGE(k, 1, DEGREE + 1)
+			{
+				result = apply_binary_operator<ArrayMultiplication>(&allocator, result, box_array(input_array));
+				result = apply_binary_operator<ArrayAddition>(&allocator, result, box_number(coefficient_buffer[k]));
+			}
+			FOR_ELEMS(it, unbox_array(result)->elements, ARRAY_COUNT)
+			{
+				array_checksum += *it;
+			}
+
+			allocator.value_arena.used = array_used;
+		}
+	}
+	f64 array_time = benchmark_seconds() - array_start;
+
+	if (raw_checksum != number_checksum || (sizeof(Element) == sizeof(Number) && raw_checksum != array_checksum))
+	{
+		printf("\tchecksums differ :: %f :: %f :: %f\n", raw_checksum, number_checksum, array_checksum);
+		return;
+	}
+
+	printf("\tplain f%-2d             :: %8.3f ns/operation\n", static_cast<i32>(sizeof(Number) * 8), raw_time / operation_count * 1e9);
+	printf("\tnumbers               :: %8.3f ns/operation\n", number_time / operation_count * 1e9);
+	printf("\tarrays of %d           :: %8.3f ns/element\n", ARRAY_COUNT, array_time / operation_count * 1e9);
+
+	// @NOTE@ Rebinding `x` forgets every value, so each evaluation walks the whole ledger again.
+	strlit source =
+		"x = 0.5;\n"
+		"p = ((((((((0.111 * x + 0.125) * x + 0.142) * x + 0.166) * x + 0.2) * x + 0.25) * x + 0.333) * x + 0.5) * x + 1);\n"
+		"f(t) = t * t - 2 * t + 1;\n"
+		"q = f(p) + sin(x) * cos(x);\n";
+
+	MeatHandle* handle = meat_compile(source, static_cast<i32>(strlen(source)), 0, 0);
+	i32         x_slot = meat_find_slot(handle, "x");
+	i32         q_slot = meat_find_slot(handle, "q");
+
+	f64 ledger_checksum = 0.0;
+	f64 ledger_start    = benchmark_seconds();
+	FOR_RANGE(i, EVALUATION_COUNT)
+	{
+		meat_bind_f64(handle, x_slot, static_cast<f64>(i) / EVALUATION_COUNT);
+		ledger_checksum += meat_evaluate_f64(handle, q_slot);
+	}
+	f64 ledger_time = benchmark_seconds() - ledger_start;
+	meat_free(handle);
+
+	printf("\tledger                :: %8.2f ns/evaluation :: checksum %f\n", ledger_time / EVALUATION_COUNT * 1e9, ledger_checksum);
+}
+
+//
+// Integers.
+//
+
+// @NOTE@ Multiplies and prints the same random magnitudes both ways, which must agree to the limb and to the digit, and then evaluates
+// 100!/(50! * 50!) with the operators the interpreter applies to integers and to numbers.
+internal void benchmark_integers(MemoryArena* arena)
+{
+	constexpr i32 MULTIPLICATION_WORK = 1 << 24; // @NOTE@ Schoolbook limb products per measurement.
+	constexpr i32 FORMAT_COUNT        = 1 << 13;
+	constexpr i32 BINOMIAL_COUNT      = 1 << 12;
+
+	printf("Integers :: Karatsuba below %d limbs is schoolbook\n", KARATSUBA_THRESHOLD);
+
+	u32 state = 0x9E3779B9;
+	lambda next_limb =
+		[&]()
+		{
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return state;
+		};
+
+	for (i32 count = 16; count <= 4096; count *= 4)
+	{
+		memory_arena_checkpoint(arena);
+
+		u32* left              = memory_arena_allocate<u32>(arena, count);
+		u32* right             = memory_arena_allocate<u32>(arena, count);
+		u32* schoolbook_result = memory_arena_allocate<u32>(arena, 2 * count);
+		u32* karatsuba_result  = memory_arena_allocate<u32>(arena, 2 * count);
+		FOR_RANGE(i, count)
+		{
+			left [i] = next_limb();
+			right[i] = next_limb();
+		}
+
+		i32 round_count = max(MULTIPLICATION_WORK / (count * count), 1);
+
+		f64 schoolbook_start = benchmark_seconds();
+		FOR_RANGE(round_count)
+		{
+			multiply_limbs_schoolbook(schoolbook_result, left, count, right, count);
+		}
+		f64 schoolbook_time = benchmark_seconds() - schoolbook_start;
+
+		f64 karatsuba_start = benchmark_seconds();
+		FOR_RANGE(round_count)
+		{
+			multiply_limbs(karatsuba_result, left, count, right, count, arena);
+		}
+		f64 karatsuba_time = benchmark_seconds() - karatsuba_start;
+
+		if (memcmp(schoolbook_result, karatsuba_result, sizeof(u32) * 2 * count))
+		{
+			printf("\t%4d limbs :: products differ\n", count);
+			continue;
+		}
+
+		printf("\t%4d limbs :: schoolbook %10.2f us/product :: Karatsuba %10.2f us/product :: %.2fx\n", count, schoolbook_time / round_count * 1e6, karatsuba_time / round_count * 1e6, schoolbook_time / karatsuba_time);
+	}
+
+	{
+		memory_arena_checkpoint(arena);
+
+		u32*  limbs     = memory_arena_allocate<u32 >(arena, FORMAT_COUNT);
+		char* by_limb   = memory_arena_allocate<char>(arena, 10 * FORMAT_COUNT + 1);
+		char* by_halves = memory_arena_allocate<char>(arena, 10 * FORMAT_COUNT + 1);
+		FOR_ELEMS(it, limbs, FORMAT_COUNT)
+		{
+			*it = next_limb();
+		}
+		limbs[FORMAT_COUNT - 1] |= 1;
+
+		f64 by_limb_start = benchmark_seconds();
+		i32 by_limb_size  = format_limbs_by_limb(by_limb, limbs, FORMAT_COUNT, 0, arena);
+		f64 by_limb_time  = benchmark_seconds() - by_limb_start;
+
+		f64 by_halves_start = benchmark_seconds();
+		i32 by_halves_size  = format_limbs(by_halves, limbs, FORMAT_COUNT, arena);
+		f64 by_halves_time  = benchmark_seconds() - by_halves_start;
+
+		if (by_limb_size != by_halves_size || memcmp(by_limb, by_halves, by_limb_size))
+		{
+			printf("\tprinting %d limbs :: digits differ\n", FORMAT_COUNT);
+		}
+		else
+		{
+			printf("\tprinting %d digits :: nine at a time %8.2f ms :: by halves %8.2f ms :: %.2fx\n", by_limb_size, by_limb_time * 1e3, by_halves_time * 1e3, by_limb_time / by_halves_time);
+		}
+	}
+
+	memory_arena_checkpoint(arena);
+
+	// @NOTE@ Values come from a value arena that is reset after every evaluation. With numbers, 100! is already out of range in f32.
+	Allocator allocator = {};
+	allocator.value_arena.size = KIBIBYTES_OF(64);
+	allocator.value_arena.base = memory_arena_allocate<byte>(arena, allocator.value_arena.size);
+
+	lambda evaluate_binomial =
+		[&](Value hundred, Value fifty)
+		{
+			Value numerator   = apply_unary_operator<ArrayFactorial>(&allocator, hundred);
+			Value half        = apply_unary_operator<ArrayFactorial>(&allocator, fifty);
+			Value denominator = apply_binary_operator<ArrayMultiplication>(&allocator, half, half);
+			return apply_binary_operator<ArrayDivision>(&allocator, numerator, denominator);
+		};
+
+	f64 integer_checksum = 0.0;
+	f64 integer_start    = benchmark_seconds();
+	FOR_RANGE(BINOMIAL_COUNT)
+	{
+		integer_checksum           += get_value_number(evaluate_binomial(box_integer(&allocator, 100, false), box_integer(&allocator, 50, false)));
+		allocator.value_arena.used  = 0;
+	}
+	f64 integer_time = benchmark_seconds() - integer_start;
+
+	f64 number_checksum = 0.0;
+	f64 number_start    = benchmark_seconds();
+	FOR_RANGE(BINOMIAL_COUNT)
+	{
+		number_checksum            += get_value_number(evaluate_binomial(box_number(100), box_number(50)));
+		allocator.value_arena.used  = 0;
+	}
+	f64 number_time = benchmark_seconds() - number_start;
+
+	printf("\t100!/(50! * 50!) :: integers %8.2f us/evaluation :: numbers %8.2f us/evaluation :: %.17g against %.17g\n", integer_time / BINOMIAL_COUNT * 1e6, number_time / BINOMIAL_COUNT * 1e6, integer_checksum / BINOMIAL_COUNT, number_checksum / BINOMIAL_COUNT);
+}
+
+int main(void)
+{
+	MemoryArena arena;
+	arena.size = MEBIBYTES_OF(64);
+	arena.base = reinterpret_cast<byte*>(malloc(arena.size));
+	arena.used = 0;
+	DEFER { free(arena.base); };
+
+	benchmark_job_system(&arena);
+	benchmark_perfect_hash(&arena);
+	benchmark_values(&arena);
+	benchmark_integers(&arena);
+
+	return 0;
+}
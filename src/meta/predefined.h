@@ -1,16 +1,150 @@
 #pragma once
 
-global constexpr struct { StringView name; Value value; } PREDEFINED_CONSTANTS[] =
+#include "../predefined.cpp"
+
+internal Value thunk_sin(FunctionArgumentNode* arguments)
+{
+	return box_number(function_sin<Number>(unbox_number(arguments->value)));
+}
+
+internal Dual dual_sin(Dual* arguments)
+{
+	return function_sin<Dual>(arguments[0]);
+}
+
+internal void array_sin(Element* result, i32 count, Element** arguments)
+{
+	Element* argument_0 = arguments[0];
+	FOR_RANGE(i, count)
+	{
+		result[i] = function_sin<Element>(argument_0[i]);
+	}
+}
+
+internal Value thunk_cos(FunctionArgumentNode* arguments)
+{
+	return box_number(function_cos<Number>(unbox_number(arguments->value)));
+}
+
+internal Dual dual_cos(Dual* arguments)
+{
+	return function_cos<Dual>(arguments[0]);
+}
+
+internal void array_cos(Element* result, i32 count, Element** arguments)
+{
+	Element* argument_0 = arguments[0];
+	FOR_RANGE(i, count)
+	{
+		result[i] = function_cos<Element>(argument_0[i]);
+	}
+}
+
+internal Value thunk_tan(FunctionArgumentNode* arguments)
+{
+	return box_number(function_tan<Number>(unbox_number(arguments->value)));
+}
+
+internal Dual dual_tan(Dual* arguments)
+{
+	return function_tan<Dual>(arguments[0]);
+}
+
+internal void array_tan(Element* result, i32 count, Element** arguments)
+{
+	Element* argument_0 = arguments[0];
+	FOR_RANGE(i, count)
+	{
+		result[i] = function_tan<Element>(argument_0[i]);
+	}
+}
+
+internal Value thunk_atan2(FunctionArgumentNode* arguments)
+{
+	return box_number(function_atan2<Number>(unbox_number(arguments->value), unbox_number(arguments->next_node->value)));
+}
+
+internal Dual dual_atan2(Dual* arguments)
+{
+	return function_atan2<Dual>(arguments[0], arguments[1]);
+}
+
+internal void array_atan2(Element* result, i32 count, Element** arguments)
+{
+	Element* argument_0 = arguments[0];
+	Element* argument_1 = arguments[1];
+	FOR_RANGE(i, count)
+	{
+		result[i] = function_atan2<Element>(argument_0[i], argument_1[i]);
+	}
+}
+
+internal Value thunk_rand(FunctionArgumentNode* arguments)
+{
+	return box_number(function_rand<Number>(unbox_number(arguments->value), unbox_number(arguments->next_node->value)));
+}
+
+internal Dual dual_rand(Dual* arguments)
+{
+	return { function_rand<Number>(arguments[0].value, arguments[1].value), 0 };
+}
+
+internal void array_rand(Element* result, i32 count, Element** arguments)
+{
+	Element* argument_0 = arguments[0];
+	Element* argument_1 = arguments[1];
+	FOR_RANGE(i, count)
+	{
+		result[i] = function_rand<Element>(argument_0[i], argument_1[i]);
+	}
+}
+
+internal Value thunk_randn(FunctionArgumentNode* arguments)
+{
+	return box_number(function_randn<Number>(unbox_number(arguments->value), unbox_number(arguments->next_node->value)));
+}
+
+internal Dual dual_randn(Dual* arguments)
+{
+	return { function_randn<Number>(arguments[0].value, arguments[1].value), 0 };
+}
+
+internal void array_randn(Element* result, i32 count, Element** arguments)
+{
+	Element* argument_0 = arguments[0];
+	Element* argument_1 = arguments[1];
+	FOR_RANGE(i, count)
+	{
+		result[i] = function_randn<Element>(argument_0[i], argument_1[i]);
+	}
+}
+
+global constexpr struct { StringView name; Number value; } PREDEFINED_CONSTANTS[] =
+	{
+		{ STRING_VIEW_OF("tau"), constant_tau<Number> },
+		{ STRING_VIEW_OF("pi"), constant_pi<Number> },
+		{ STRING_VIEW_OF("e"), constant_e<Number> },
+	};
+
+global constexpr u32 PREDEFINED_CONSTANT_DISPLACEMENTS[] =
 	{
-		{ STRING_VIEW_OF("e"), constant_e },
-		{ STRING_VIEW_OF("pi"), constant_pi },
-		{ STRING_VIEW_OF("tau"), constant_tau },
+		0,
 	};
 
-global constexpr struct { StringView name; Function* function; } PREDEFINED_FUNCTIONS[] =
+global constexpr struct { StringView name; Function* function; ArrayFunction* array_function; DualFunction* dual_function; i32 arity; bool8 is_pure; bool8 is_vectorizable; } PREDEFINED_FUNCTIONS[] =
 	{
-		{ STRING_VIEW_OF("sin"), function_sin },
-		{ STRING_VIEW_OF("cos"), function_cos },
-		{ STRING_VIEW_OF("tan"), function_tan },
-		{ STRING_VIEW_OF("atan2"), function_atan2 },
+		{ STRING_VIEW_OF("rand"), thunk_rand, array_rand, dual_rand, 2, true, true },
+		{ STRING_VIEW_OF("tan"), thunk_tan, array_tan, dual_tan, 1, true, true },
+		{ STRING_VIEW_OF("atan2"), thunk_atan2, array_atan2, dual_atan2, 2, true, true },
+		{ STRING_VIEW_OF("sin"), thunk_sin, array_sin, dual_sin, 1, true, true },
+		{ STRING_VIEW_OF("cos"), thunk_cos, array_cos, dual_cos, 1, true, true },
+		{ STRING_VIEW_OF("randn"), thunk_randn, array_randn, dual_randn, 2, true, true },
 	};
+
+global constexpr u32 PREDEFINED_FUNCTION_DISPLACEMENTS[] =
+	{
+		111, 0,
+	};
+
+// @NOTE@ The hash the built-ins were generated from, so that values saved by one build are not read back by a build whose built-ins differ.
+global constexpr u64 PREDEFINED_HASH = 0x7D96473B5EC323DE;
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include "unified.h"
 
 #define META_printf(FSTR, ...)\
@@ -24,6 +25,27 @@ while (false)
 #undef  ASSERT
 #define ASSERT META_ASSERT_
 
+// @NOTE@ Reserved words and operators of the Meat lexer. Each entry is compiled into the DFA of `meta/lexer.h` and yields the given
+// `TokenKind` of Meat.cpp; the lexer takes the longest match, so an operator may be a prefix of a longer one.
+global constexpr struct { strlit string; strlit kind; } LEXER_SPECIFICATION[] =
+	{
+		{ "ASSERT", "assertion"         },
+		{ ";"     , "semicolon"         },
+		{ "="     , "equal"             },
+		{ ","     , "comma"             },
+		{ "+"     , "plus"              },
+		{ "-"     , "minus"             },
+		{ "*"     , "asterisk"          },
+		{ "/"     , "forward_slash"     },
+		{ "^"     , "caret"             },
+		{ "!"     , "exclamation_point" },
+		{ "("     , "parenthesis_start" },
+		{ ")"     , "parenthesis_end"   },
+		{ "["     , "bracket_start"     },
+		{ "]"     , "bracket_end"       },
+		{ ":"     , "colon"             }
+	};
+
 // @TODO@ Multiple character tokens (e.g. `<=`) are not handled.
 enum struct TokenKind : u8
 {
@@ -45,34 +67,68 @@ struct Token
 
 struct Tokenizer
 {
-	i32   stream_size;
-	char* stream_data;
-	i32   current_index;
+	i32         stream_size;
+	const char* stream_data;
+	i32         current_index;
 };
 
-// @TODO@ Handle non-existing files.
-internal Tokenizer init_tokenizer_from_file(strlit file_path)
+//
+// Output.
+//
+
+// @NOTE@ Generated files are built in memory so they can be compared against what is already on disk. Grows with `realloc`, which unlike
+// `StringBuilder` does not share a free list between threads.
+struct OutputBuffer
 {
-	FILE* file;
-	errno_t file_errno = fopen_s(&file, file_path, "rb");
-	ASSERT(file_errno == 0);
-	DEFER { fclose(file); };
+	char* data;
+	i32   size;
+	i32   capacity;
+};
 
-	Tokenizer tokenizer;
-	tokenizer.current_index = 0;
+internal void deinit_output_buffer(OutputBuffer* output)
+{
+	free(output->data);
+	*output = {};
+}
+
+template <typename... ARGUMENTS>
+internal void output_format(OutputBuffer* output, strlit format, ARGUMENTS... arguments)
+{
+	while (true)
+	{
+		i32 count = snprintf(output->data + output->size, output->capacity - output->size, format, arguments...);
+		ASSERT(count >= 0);
 
-	fseek(file, 0, SEEK_END);
-	tokenizer.stream_size = ftell(file);
-	tokenizer.stream_data = reinterpret_cast<char*>(malloc(tokenizer.stream_size));
-	fseek(file, 0, SEEK_SET);
-	fread(tokenizer.stream_data, sizeof(char), tokenizer.stream_size, file);
+		if (output->size + count < output->capacity)
+		{
+			output->size += count;
+			return;
+		}
 
-	return tokenizer;
+		output->capacity = max({ output->capacity * 2, output->size + count + 1, 4096 });
+		output->data     = reinterpret_cast<char*>(realloc(output->data, output->capacity));
+		ASSERT(output->data);
+	}
 }
 
-internal void deinit_tokenizer_from_file(Tokenizer tokenizer)
+// @NOTE@ Leaves the file untouched when it already has these bytes, so its timestamp does not trigger a rebuild of what includes it.
+internal bool32 write_file_if_changed(strlit file_path, OutputBuffer* output, bool32* is_written)
 {
-	free(tokenizer.stream_data);
+	MappedFile existing_file;
+	if (!init_mapped_file(&existing_file, file_path))
+	{
+		bool32 is_same = existing_file.size == static_cast<memsize>(output->size) && memcmp(existing_file.data, output->data, output->size) == 0;
+		deinit_mapped_file(&existing_file);
+
+		if (is_same)
+		{
+			*is_written = false;
+			return false;
+		}
+	}
+
+	*is_written = true;
+	return write_entire_file(file_path, output->data, output->size);
 }
 
 // @TODO@ Does not handle cases like escaped newlines.
@@ -134,7 +190,7 @@ internal Token eat_token(Tokenizer* tokenizer)
 			token.string.size = 0;
 			token.string.data = tokenizer->stream_data + tokenizer->current_index;
 
-			while (is_alpha(tokenizer->stream_data[tokenizer->current_index]) || is_digit(tokenizer->stream_data[tokenizer->current_index]) || tokenizer->stream_data[tokenizer->current_index] == '_')
+			while (tokenizer->current_index < tokenizer->stream_size && (is_alpha(tokenizer->stream_data[tokenizer->current_index]) || is_digit(tokenizer->stream_data[tokenizer->current_index]) || tokenizer->stream_data[tokenizer->current_index] == '_'))
 			{
 				tokenizer->current_index += 1;
 				token.string.size        += 1;
@@ -204,25 +260,95 @@ internal Token peek_token(Tokenizer tokenizer)
 	return eat_token(&tokenizer);
 }
 
-int main(void)
+struct PredefinedEntry
 {
-	Tokenizer tokenizer = init_tokenizer_from_file(SRC_DIR "predefined.cpp");
-	DEFER { deinit_tokenizer_from_file(tokenizer); };
+	StringView name;        // @NOTE@ As seen by Meat, without the prefix of the identifier.
+	char       fields[128]; // @NOTE@ Everything in the initializer of the entry after its name.
+};
 
-	FILE* output_file;
-	errno_t output_file_errno = fopen_s(&output_file, SRC_DIR "meta/predefined.h", "wb");
-	ASSERT(output_file_errno == 0);
-	DEFER { fclose(output_file); };
+struct PredefinedItem
+{
+	StringView identifier;
+	bool32     is_function;
+	i32        arity;
+	bool32     is_pure;
+	bool32     is_vectorizable;
+	bool32     is_piecewise_constant;
+};
+
+struct PredefinedItemBufferNode
+{
+	PredefinedItemBufferNode* next_node;
+	i32                       count;
+	PredefinedItem            buffer[64];
+};
 
-	constexpr StringView CONSTANT_PREFIX = STRING_VIEW_OF("constant_");
-	constexpr StringView FUNCTION_PREFIX = STRING_VIEW_OF("function_");
+// @NOTE@ Identifiers of the items point into the mapped file, so it stays mapped until the tables are written.
+struct PredefinedInput
+{
+	char                      file_name[MAX_PATH];
+	MappedFile                file;
+	bool32                    is_mapped;
+	u64                       hash;
+	PredefinedItemBufferNode* head_item_buffer_node;
+	PredefinedItemBufferNode* curr_item_buffer_node;
+};
 
-	i32        predefined_constant_count = 0;
-	StringView predefined_constant_buffer[64];
+global constexpr StringView CONSTANT_PREFIX = STRING_VIEW_OF("constant_");
+global constexpr StringView FUNCTION_PREFIX = STRING_VIEW_OF("function_");
+global constexpr StringView SCALAR_TYPE     = STRING_VIEW_OF("SCALAR"); // @NOTE@ The template parameter every built-in computes in.
 
-	i32        predefined_function_count = 0;
-	StringView predefined_function_buffer[64];
+internal PredefinedItem* push_predefined_item(PredefinedInput* input)
+{
+	if (!input->curr_item_buffer_node || input->curr_item_buffer_node->count == ARRAY_CAPACITY(input->curr_item_buffer_node->buffer))
+	{
+		PredefinedItemBufferNode* node = reinterpret_cast<PredefinedItemBufferNode*>(malloc(sizeof(PredefinedItemBufferNode)));
+		ASSERT(node);
+		node->next_node = 0;
+		node->count     = 0;
 
+		if (input->curr_item_buffer_node)
+		{
+			input->curr_item_buffer_node->next_node = node;
+		}
+		else
+		{
+			input->head_item_buffer_node = node;
+		}
+		input->curr_item_buffer_node = node;
+	}
+
+	PredefinedItem* item = &input->curr_item_buffer_node->buffer[input->curr_item_buffer_node->count];
+	input->curr_item_buffer_node->count += 1;
+	*item = {};
+	return item;
+}
+
+internal void deinit_predefined_input(PredefinedInput* input)
+{
+	while (input->head_item_buffer_node)
+	{
+		free(pop_node(&input->head_item_buffer_node));
+	}
+
+	if (input->is_mapped)
+	{
+		deinit_mapped_file(&input->file);
+	}
+}
+
+// @NOTE@ Collects the `constant_` and `function_` declarations of an input along with the annotations of the functions.
+internal void scan_predefined_input(PredefinedInput* input)
+{
+	Tokenizer tokenizer;
+	tokenizer.stream_size   = static_cast<i32>(input->file.size);
+	tokenizer.stream_data   = reinterpret_cast<const char*>(input->file.data);
+	tokenizer.current_index = 0;
+
+	bool32     is_pure               = false;
+	bool32     is_vectorizable       = false;
+	bool32     is_piecewise_constant = false;
+	StringView previous_string       = {};
 	while (tokenizer.current_index < tokenizer.stream_size)
 	{
 		Token token = eat_token(&tokenizer);
@@ -236,55 +362,611 @@ int main(void)
 
 			case TokenKind::identifier:
 			{
-				if (starts_with(CONSTANT_PREFIX, token.string))
+				if (token.string == STRING_VIEW_OF("PREDEFINED_PURE"))
+				{
+					is_pure = true;
+				}
+				else if (token.string == STRING_VIEW_OF("PREDEFINED_VECTORIZABLE"))
+				{
+					is_vectorizable = true;
+				}
+				else if (token.string == STRING_VIEW_OF("PREDEFINED_PIECEWISE_CONSTANT"))
+				{
+					is_piecewise_constant = true;
+				}
+				else if (previous_string == SCALAR_TYPE && starts_with(CONSTANT_PREFIX, token.string))
 				{
 					ASSERT(token.string.size > CONSTANT_PREFIX.size);
-					predefined_constant_buffer[predefined_constant_count]  = token.string;
-					predefined_constant_count                             += 1;
+					ASSERT(!is_pure && !is_vectorizable && !is_piecewise_constant); // Annotations only apply to functions.
+
+					PredefinedItem* constant = push_predefined_item(input);
+					constant->identifier = token.string;
 				}
-				else if (starts_with(FUNCTION_PREFIX, token.string))
+				else if (previous_string == SCALAR_TYPE && starts_with(FUNCTION_PREFIX, token.string))
 				{
 					ASSERT(token.string.size > FUNCTION_PREFIX.size);
-					predefined_function_buffer[predefined_function_count]  = token.string;
-					predefined_function_count                             += 1;
+
+					PredefinedItem* function = push_predefined_item(input);
+					function->identifier            = token.string;
+					function->is_function           = true;
+					function->is_pure               = is_pure;
+					function->is_vectorizable       = is_vectorizable;
+					function->is_piecewise_constant = is_piecewise_constant;
+					is_pure                         = false;
+					is_vectorizable                 = false;
+					is_piecewise_constant           = false;
+
+					ASSERT(eat_token(&tokenizer).kind == static_cast<TokenKind>('('));
+
+					Token parameter_token = eat_token(&tokenizer);
+					if (parameter_token.string == STRING_VIEW_OF("void"))
+					{
+						parameter_token = eat_token(&tokenizer);
+					}
+
+					while (parameter_token.kind != static_cast<TokenKind>(')'))
+					{
+						ASSERT(parameter_token.string == SCALAR_TYPE); // Built-ins take and return numbers.
+						ASSERT(eat_token(&tokenizer).kind == TokenKind::identifier);
+						function->arity += 1;
+
+						parameter_token = eat_token(&tokenizer);
+						if (parameter_token.kind == static_cast<TokenKind>(','))
+						{
+							parameter_token = eat_token(&tokenizer);
+						}
+						else
+						{
+							ASSERT(parameter_token.kind == static_cast<TokenKind>(')'));
+						}
+					}
 				}
 			} break;
 		}
+
+		previous_string = token.string;
+	}
+
+	ASSERT(!is_pure && !is_vectorizable && !is_piecewise_constant); // Annotations only apply to functions.
+}
+
+// @NOTE@ Entries are written in the order of their slots in a minimal perfect hash of the names, so the table can be indexed directly
+// with `get_perfect_hash_slot` and the displacements written after it.
+internal void write_predefined_table(OutputBuffer* output, strlit declaration, strlit displacement_name, PredefinedEntry* entry_buffer, i32 entry_count, MemoryArena* arena)
+{
+	memory_arena_checkpoint(arena);
+
+	ASSERT(entry_count > 0);
+
+	i32               bucket_count        = get_perfect_hash_bucket_count(entry_count);
+	u32*              displacement_buffer = memory_arena_allocate<u32>(arena, bucket_count);
+	i32*              slot_buffer         = memory_arena_allocate<i32>(arena, entry_count);
+	u64*              hash_buffer         = memory_arena_allocate<u64>(arena, entry_count);
+	PredefinedEntry** slotted_buffer      = memory_arena_allocate<PredefinedEntry*>(arena, entry_count);
+
+	FOR_ELEMS(it, entry_buffer, entry_count)
+	{
+		hash_buffer[it_index] = hash_bytes(it->name);
+	}
+
+	bool32 failed = init_perfect_hash(displacement_buffer, bucket_count, slot_buffer, hash_buffer, entry_count, arena);
+	ASSERT(!failed); // Two predefined names have the same hash.
+
+	FOR_RANGE(i, entry_count)
+	{
+		slotted_buffer[slot_buffer[i]] = &entry_buffer[i];
+	}
+
+	output_format(output, "\n%s\n\t{\n", declaration);
+	FOR_ELEMS(it, slotted_buffer, entry_count)
+	{
+		output_format(output, "\t\t{ STRING_VIEW_OF(\"%.*s\"), %s },\n", PASS_STRING_VIEW((*it)->name), (*it)->fields);
+	}
+	output_format(output, "\t};\n");
+
+	output_format(output, "\nglobal constexpr u32 %s[] =\n\t{\n\t\t", displacement_name);
+	FOR_ELEMS(it, displacement_buffer, bucket_count)
+	{
+		output_format(output, "%u,%s", *it, it_index + 1 == bucket_count ? "\n" : (it_index % 16 == 15 ? "\n\t\t" : " "));
+	}
+	output_format(output, "\t};\n");
+}
+
+// @NOTE@ Built-ins take their arguments as separate `SCALAR` parameters so that the arity is part of the signature. Meat calls them
+// through a thunk that unpacks the argument list and boxes the result; the arity is checked once when parsing, so the thunk does not check
+// it again. Thunks compute in `Number` and kernels in `Element`.
+internal void write_predefined_thunk(OutputBuffer* output, PredefinedItem* function)
+{
+	output_format
+	(
+		output,
+		"\ninternal Value thunk_%.*s(FunctionArgumentNode*%s)\n{\n\treturn box_number(%.*s<Number>(",
+		function->identifier.size - FUNCTION_PREFIX.size, function->identifier.data + FUNCTION_PREFIX.size,
+		function->arity ? " arguments" : "",
+		PASS_STRING_VIEW(function->identifier)
+	);
+
+	FOR_RANGE(i, function->arity)
+	{
+		output_format(output, "%sunbox_number(arguments->", i ? ", " : "");
+		FOR_RANGE(i)
+		{
+			output_format(output, "next_node->");
+		}
+		output_format(output, "value)");
 	}
 
-	fprintf
+	output_format(output, "));\n}\n");
+}
+
+// @NOTE@ Every built-in also gets a thunk in dual numbers, so that functions calling it can be differentiated. Those marked
+// `PREDEFINED_PIECEWISE_CONSTANT` are computed on the values alone and never instantiated for `Dual`.
+internal void write_predefined_dual_thunk(OutputBuffer* output, PredefinedItem* function)
+{
+	output_format
 	(
-		output_file,
+		output,
+		"\ninternal Dual dual_%.*s(Dual*%s)\n{\n\treturn %s%.*s<%s>(",
+		function->identifier.size - FUNCTION_PREFIX.size, function->identifier.data + FUNCTION_PREFIX.size,
+		function->arity ? " arguments" : "",
+		function->is_piecewise_constant ? "{ " : "",
+		PASS_STRING_VIEW(function->identifier),
+		function->is_piecewise_constant ? "Number" : "Dual"
+	);
+
+	FOR_RANGE(i, function->arity)
+	{
+		output_format(output, "%sarguments[%d]%s", i ? ", " : "", i, function->is_piecewise_constant ? ".value" : "");
+	}
+
+	output_format(output, "%s;\n}\n", function->is_piecewise_constant ? "), 0 }" : ")");
+}
+
+// @NOTE@ Built-ins marked `PREDEFINED_VECTORIZABLE` also get a kernel that applies them over whole arrays in one loop, which the compiler
+// can vectorize. Every argument is an array of `count` elements; Meat spreads numbers into arrays before calling it.
+internal void write_predefined_array_kernel(OutputBuffer* output, PredefinedItem* function)
+{
+	output_format
+	(
+		output,
+		"\ninternal void array_%.*s(Element* result, i32 count, Element**%s)\n{\n",
+		function->identifier.size - FUNCTION_PREFIX.size, function->identifier.data + FUNCTION_PREFIX.size,
+		function->arity ? " arguments" : ""
+	);
+
+	FOR_RANGE(i, function->arity)
+	{
+		output_format(output, "\tElement* argument_%d = arguments[%d];\n", i, i);
+	}
+
+	output_format(output, "\tFOR_RANGE(i, count)\n\t{\n\t\tresult[i] = %.*s<Element>(", PASS_STRING_VIEW(function->identifier));
+	FOR_RANGE(i, function->arity)
+	{
+		output_format(output, "%sargument_%d[i]", i ? ", " : "", i);
+	}
+	output_format(output, ");\n\t}\n}\n");
+}
+
+// @NOTE@ The DFA is the trie of the specification. State zero is the dead state and state one is the start. Bytes that appear in no
+// entry share class zero, so the transition table only has a column per byte that is actually used.
+internal void write_lexer(OutputBuffer* output)
+{
+	u8  byte_classes[256] = {};
+	i32 class_count       = 1;
+	FOR_ELEMS(LEXER_SPECIFICATION)
+	{
+		for (strlit c = it->string; *c; c += 1)
+		{
+			if (!byte_classes[static_cast<u8>(*c)])
+			{
+				ASSERT(class_count < 256);
+				byte_classes[static_cast<u8>(*c)]  = static_cast<u8>(class_count);
+				class_count                       += 1;
+			}
+		}
+	}
+
+	persist u8     transitions[256][256];
+	persist strlit accepted_kinds[256];
+	i32            state_count = 2;
+	memset(transitions   , 0, sizeof(transitions   ));
+	memset(accepted_kinds, 0, sizeof(accepted_kinds));
+
+	FOR_ELEMS(LEXER_SPECIFICATION)
+	{
+		ASSERT(it->string[0]);
+
+		i32 state = 1;
+		for (strlit c = it->string; *c; c += 1)
+		{
+			aliasing next_state = transitions[state][byte_classes[static_cast<u8>(*c)]];
+			if (!next_state)
+			{
+				ASSERT(state_count < 256);
+				next_state   = static_cast<u8>(state_count);
+				state_count += 1;
+			}
+			state = next_state;
+		}
+
+		ASSERT(!accepted_kinds[state]); // Duplicate entry in the lexer specification.
+		accepted_kinds[state] = it->kind;
+	}
+
+	output_format
+	(
+		output,
 		"#pragma once\n"
 		"\n"
-		"global constexpr struct { StringView name; Value value; } PREDEFINED_CONSTANTS[] =\n"
-		"\t{\n"
+		"global constexpr i32 LEXER_START_STATE = 1;\n"
+		"\n"
+		"global constexpr u8 LEXER_BYTE_CLASSES[256] =\n"
+		"\t{"
 	);
 
-	FOR_ELEMS(it, predefined_constant_buffer, predefined_constant_count)
+	FOR_RANGE(i, 256)
 	{
-		fprintf(output_file, "\t\t{ STRING_VIEW_OF(\"%.*s\"), %.*s },\n", it->size - CONSTANT_PREFIX.size, it->data + CONSTANT_PREFIX.size, PASS_STRING_VIEW(*it));
+		output_format(output, "%s%d,", i % 32 ? " " : "\n\t\t", byte_classes[i]);
 	}
 
-	fprintf
+	output_format
 	(
-		output_file,
+		output,
+		"\n"
 		"\t};\n"
 		"\n"
-		"global constexpr struct { StringView name; Function* function; } PREDEFINED_FUNCTIONS[] =\n"
-		"\t{\n"
+		"global constexpr u8 LEXER_TRANSITIONS[%d][%d] =\n"
+		"\t{\n",
+		state_count, class_count
 	);
 
-	FOR_ELEMS(it, predefined_function_buffer, predefined_function_count)
+	FOR_RANGE(state, state_count)
 	{
-		fprintf(output_file, "\t\t{ STRING_VIEW_OF(\"%.*s\"), %.*s },\n", it->size - FUNCTION_PREFIX.size, it->data + FUNCTION_PREFIX.size, PASS_STRING_VIEW(*it));
+		output_format(output, "\t\t{");
+		FOR_RANGE(i, class_count)
+		{
+			output_format(output, " %d,", transitions[state][i]);
+		}
+		output_format(output, " },\n");
 	}
 
-	fprintf
+	output_format
 	(
-		output_file,
+		output,
 		"\t};\n"
+		"\n"
+		"// @NOTE@ `TokenKind::eof` marks states that do not end a token.\n"
+		"global constexpr TokenKind LEXER_ACCEPTED_KINDS[%d] =\n"
+		"\t{\n",
+		state_count
 	);
 
+	FOR_RANGE(state, state_count)
+	{
+		output_format(output, "\t\tTokenKind::%s,\n", accepted_kinds[state] ? accepted_kinds[state] : "eof");
+	}
+
+	output_format
+	(
+		output,
+		"\t};\n"
+	);
+}
+
+internal void write_predefined(OutputBuffer* output, PredefinedInput* input_buffer, i32 input_count, u64 input_hash, MemoryArena* arena)
+{
+	memory_arena_checkpoint(arena);
+
+	output_format(output, "#pragma once\n\n");
+
+	i32 constant_count = 0;
+	i32 function_count = 0;
+	FOR_ELEMS(input, input_buffer, input_count)
+	{
+		output_format(output, "#include \"../%s\"\n", input->file_name);
+
+		FOR_NODES(input->head_item_buffer_node)
+		{
+			FOR_ELEMS(item, it->buffer, it->count)
+			{
+				if (item->is_function)
+				{
+					function_count += 1;
+				}
+				else
+				{
+					constant_count += 1;
+				}
+			}
+		}
+	}
+
+	PredefinedEntry* constant_entry_buffer = memory_arena_allocate<PredefinedEntry>(arena, constant_count);
+	PredefinedEntry* function_entry_buffer = memory_arena_allocate<PredefinedEntry>(arena, function_count);
+	constant_count = 0;
+	function_count = 0;
+
+	FOR_ELEMS(input, input_buffer, input_count)
+	{
+		FOR_NODES(input->head_item_buffer_node)
+		{
+			FOR_ELEMS(item, it->buffer, it->count)
+			{
+				if (item->is_function)
+				{
+					write_predefined_thunk(output, item);
+					write_predefined_dual_thunk(output, item);
+					if (item->is_vectorizable)
+					{
+						write_predefined_array_kernel(output, item);
+					}
+
+					aliasing entry = function_entry_buffer[function_count];
+					function_count += 1;
+
+					entry.name = { item->identifier.size - FUNCTION_PREFIX.size, item->identifier.data + FUNCTION_PREFIX.size };
+					sprintf_s
+					(
+						entry.fields,
+						"thunk_%.*s, %s%.*s, dual_%.*s, %d, %s, %s",
+						PASS_STRING_VIEW(entry.name),
+						item->is_vectorizable ? "array_" : "0",
+						item->is_vectorizable ? entry.name.size : 0, entry.name.data,
+						PASS_STRING_VIEW(entry.name),
+						item->arity,
+						item->is_pure         ? "true" : "false",
+						item->is_vectorizable ? "true" : "false"
+					);
+				}
+				else
+				{
+					aliasing entry = constant_entry_buffer[constant_count];
+					constant_count += 1;
+
+					entry.name = { item->identifier.size - CONSTANT_PREFIX.size, item->identifier.data + CONSTANT_PREFIX.size };
+					sprintf_s(entry.fields, "%.*s<Number>", PASS_STRING_VIEW(item->identifier));
+				}
+			}
+		}
+	}
+
+	write_predefined_table
+	(
+		output,
+		"global constexpr struct { StringView name; Number value; } PREDEFINED_CONSTANTS[] =",
+		"PREDEFINED_CONSTANT_DISPLACEMENTS",
+		constant_entry_buffer,
+		constant_count,
+		arena
+	);
+
+	write_predefined_table
+	(
+		output,
+		"global constexpr struct { StringView name; Function* function; ArrayFunction* array_function; DualFunction* dual_function; i32 arity; bool8 is_pure; bool8 is_vectorizable; } PREDEFINED_FUNCTIONS[] =",
+		"PREDEFINED_FUNCTION_DISPLACEMENTS",
+		function_entry_buffer,
+		function_count,
+		arena
+	);
+
+	output_format
+	(
+		output,
+		"\n"
+		"// @NOTE@ The hash the built-ins were generated from, so that values saved by one build are not read back by a build whose built-ins differ.\n"
+		"global constexpr u64 PREDEFINED_HASH = 0x%016llX;\n",
+		input_hash
+	);
+}
+
+//
+// Incremental generation.
+//
+
+// @NOTE@ An output is only regenerated when the hash of its inputs differs from the one stamped by the last run, and only rewritten when
+// its bytes differ. The generator's own source is part of every hash, since changing it can change the output as much as any input.
+
+global constexpr strlit PREDEFINED_INPUT_PATTERN = SRC_DIR "predefined*.cpp";
+global constexpr strlit PREDEFINED_OUTPUT_PATH   = SRC_DIR "meta/predefined.h";
+global constexpr strlit LEXER_OUTPUT_PATH        = SRC_DIR "meta/lexer.h";
+global constexpr strlit STAMP_PATH               = EXE_DIR "metaprogram.stamp";
+global constexpr u64    STAMP_MAGIC              = 0x314154454D54454D; // "METMETA1"
+
+struct MetaprogramStamp
+{
+	u64 magic;
+	u64 predefined_hash;
+	u64 lexer_hash;
+};
+
+internal u64 hash_entire_file(strlit file_path)
+{
+	MappedFile file;
+	ASSERT(!init_mapped_file(&file, file_path));
+	DEFER { deinit_mapped_file(&file); };
+
+	return hash_bytes(file.data, file.size);
+}
+
+internal bool32 does_file_exist(strlit file_path)
+{
+	MappedFile file;
+	if (init_mapped_file(&file, file_path))
+	{
+		return false;
+	}
+
+	deinit_mapped_file(&file);
+	return true;
+}
+
+internal void map_predefined_inputs(JobWorker*, i32 start, i32 end, void* data)
+{
+	FOR_ELEMS(input, reinterpret_cast<PredefinedInput*>(data) + start, end - start)
+	{
+		char file_path[MAX_PATH];
+		sprintf_s(file_path, SRC_DIR "%s", input->file_name);
+
+		input->is_mapped = !init_mapped_file(&input->file, file_path);
+		ASSERT(input->is_mapped); // Inputs cannot be empty.
+
+		input->hash = hash_bytes(input->file.data, input->file.size, hash_bytes(input->file_name, strlen(input->file_name)));
+	}
+}
+
+internal void scan_predefined_inputs(JobWorker*, i32 start, i32 end, void* data)
+{
+	FOR_ELEMS(input, reinterpret_cast<PredefinedInput*>(data) + start, end - start)
+	{
+		scan_predefined_input(input);
+	}
+}
+
+internal void write_lexer_job(JobWorker*, void* data)
+{
+	write_lexer(reinterpret_cast<OutputBuffer*>(data));
+}
+
+internal void flush_output_buffer(strlit file_path, OutputBuffer* output)
+{
+	bool32 is_written;
+	bool32 failed = write_file_if_changed(file_path, output, &is_written);
+	ASSERT(!failed);
+
+	META_printf("Metaprogram :: `%s` %s.\n", file_path, is_written ? "written" : "regenerated without changes");
+}
+
+int main(void)
+{
+	MemoryArena arena;
+	arena.size = MEBIBYTES_OF(8);
+	arena.base = reinterpret_cast<byte*>(malloc(arena.size));
+	arena.used = 0;
+	DEFER { free(arena.base); };
+
+	i32              input_count    = 0;
+	i32              input_capacity = 0;
+	PredefinedInput* input_buffer   = 0;
+	DEFER
+	{
+		FOR_ELEMS(input, input_buffer, input_count)
+		{
+			deinit_predefined_input(input);
+		}
+		free(input_buffer);
+	};
+
+	{
+		WIN32_FIND_DATAA find_data;
+		HANDLE           find_handle = FindFirstFileA(PREDEFINED_INPUT_PATTERN, &find_data);
+		ASSERT(find_handle != INVALID_HANDLE_VALUE);
+		DEFER { FindClose(find_handle); };
+
+		do
+		{
+			if (input_count == input_capacity)
+			{
+				input_capacity = max(input_capacity * 2, 8);
+				input_buffer   = reinterpret_cast<PredefinedInput*>(realloc(input_buffer, input_capacity * sizeof(PredefinedInput)));
+				ASSERT(input_buffer);
+			}
+
+			aliasing input = input_buffer[input_count];
+			input_count += 1;
+
+			input = {};
+			strcpy_s(input.file_name, find_data.cFileName);
+		}
+		while (FindNextFileA(find_handle, &find_data));
+	}
+
+	// @NOTE@ The order of a directory listing is not guaranteed, but the order of the generated tables has to be.
+	std::sort(input_buffer, input_buffer + input_count, [](const PredefinedInput& a, const PredefinedInput& b) { return strcmp(a.file_name, b.file_name) < 0; });
+
+	persist JobSystem job_system;
+	init_job_system(&job_system, &arena, 0, KIBIBYTES_OF(4));
+	DEFER { deinit_job_system(&job_system); };
+	JobWorker* worker = &job_system.workers[0];
+
+	job_parallel_for(worker, input_count, 1, map_predefined_inputs, input_buffer);
+
+	u64 generator_hash  = hash_mix(hash_entire_file(SRC_DIR "metaprogram.cpp"), hash_entire_file(SRC_DIR "unified.h"));
+	u64 lexer_hash      = generator_hash;
+	u64 predefined_hash = generator_hash;
+	FOR_ELEMS(input, input_buffer, input_count)
+	{
+		predefined_hash = hash_mix(predefined_hash, input->hash);
+	}
+
+	MetaprogramStamp stamp = {};
+	{
+		MappedFile stamp_file;
+		if (!init_mapped_file(&stamp_file, STAMP_PATH))
+		{
+			if (stamp_file.size == sizeof(stamp))
+			{
+				memcpy(&stamp, stamp_file.data, sizeof(stamp));
+			}
+			deinit_mapped_file(&stamp_file);
+		}
+
+		if (stamp.magic != STAMP_MAGIC)
+		{
+			stamp = {};
+		}
+	}
+
+	bool32 is_predefined_stale = stamp.predefined_hash != predefined_hash || !does_file_exist(PREDEFINED_OUTPUT_PATH);
+	bool32 is_lexer_stale      = stamp.lexer_hash      != lexer_hash      || !does_file_exist(LEXER_OUTPUT_PATH);
+
+	OutputBuffer predefined_output = {};
+	OutputBuffer lexer_output      = {};
+	DEFER
+	{
+		deinit_output_buffer(&predefined_output);
+		deinit_output_buffer(&lexer_output);
+	};
+
+	// @NOTE@ The lexer is generated by another worker while the inputs are scanned.
+	JobCounter lexer_counter = {};
+	Job        lexer_job     = { write_lexer_job, &lexer_output, &lexer_counter };
+	if (is_lexer_stale)
+	{
+		job_fork(worker, &lexer_job);
+	}
+
+	if (is_predefined_stale)
+	{
+		job_parallel_for(worker, input_count, 1, scan_predefined_inputs, input_buffer);
+		write_predefined(&predefined_output, input_buffer, input_count, predefined_hash, &arena);
+		flush_output_buffer(PREDEFINED_OUTPUT_PATH, &predefined_output);
+	}
+	else
+	{
+		META_printf("Metaprogram :: `%s` is up to date.\n", PREDEFINED_OUTPUT_PATH);
+	}
+
+	if (is_lexer_stale)
+	{
+		job_wait(worker, &lexer_counter);
+		flush_output_buffer(LEXER_OUTPUT_PATH, &lexer_output);
+	}
+	else
+	{
+		META_printf("Metaprogram :: `%s` is up to date.\n", LEXER_OUTPUT_PATH);
+	}
+
+	if (is_predefined_stale || is_lexer_stale)
+	{
+		stamp.magic           = STAMP_MAGIC;
+		stamp.predefined_hash = predefined_hash;
+		stamp.lexer_hash      = lexer_hash;
+		if (write_entire_file(STAMP_PATH, &stamp, sizeof(stamp)))
+		{
+			META_printf("Metaprogram :: Could not write `%s`, so everything is regenerated next time.\n", STAMP_PATH);
+		}
+	}
+
 	return 0;
 }
@@ -1,27 +1,102 @@
-global constexpr Value constant_e   = { 2.7182818284f };
-global constexpr Value constant_pi  = { 3.1415926535f };
-global constexpr Value constant_tau = { 6.2831853071f };
+// @NOTE@ Built-ins are templated over the scalar they compute in, so that numbers, the elements of arrays and dual numbers can each use
+// their own.
 
-internal Value function_sin(FunctionArgumentNode* arguments)
+template <typename SCALAR> global constexpr SCALAR constant_e   = static_cast<SCALAR>(2.71828182845904523536);
+template <typename SCALAR> global constexpr SCALAR constant_pi  = static_cast<SCALAR>(3.14159265358979323846);
+template <typename SCALAR> global constexpr SCALAR constant_tau = static_cast<SCALAR>(6.28318530717958647692);
+
+PREDEFINED_PURE PREDEFINED_VECTORIZABLE
+template <typename SCALAR> internal SCALAR function_sin(SCALAR x)
+{
+	return sin(x);
+}
+
+PREDEFINED_PURE PREDEFINED_VECTORIZABLE
+template <typename SCALAR> internal SCALAR function_cos(SCALAR x)
+{
+	return cos(x);
+}
+
+PREDEFINED_PURE PREDEFINED_VECTORIZABLE
+template <typename SCALAR> internal SCALAR function_tan(SCALAR x)
+{
+	return tan(x);
+}
+
+PREDEFINED_PURE PREDEFINED_VECTORIZABLE
+template <typename SCALAR> internal SCALAR function_atan2(SCALAR y, SCALAR x)
+{
+	return atan2(y, x);
+}
+
+// @NOTE@ Random numbers come from Philox-4x32-10, a counter-based generator: the seed is the key and the index is the counter, so a draw
+// is a pure function of the two and the draws can be made in any order, on any thread or across the elements of an array. Both are read
+// as integers, with any fraction dropped; non-finite and out-of-range ones read as zero. They are read in the precision they arrive in,
+// which is `f32` for every number of a 32-bit build and for the elements of arrays in a mixed one, where a number given alongside an
+// array is also rounded to an element first. Above 2^24 not every integer is an `f32`, so there neighbouring seeds or indices name the
+// same draw, and a mixed build can draw differently for a number than for an element. Below 2^24 the draws agree in every build, an
+// `f32` draw of `rand` being the `f64` one cut to 24 bits.
+
+internal u64 get_random_word(f64 x)
 {
-	ASSERT(!arguments->next_node);
-	return { sinf(arguments->value) };
+	return x == x && fabs(x) < 9.2e18 ? static_cast<u64>(static_cast<i64>(x)) : 0;
 }
 
-internal Value function_cos(FunctionArgumentNode* arguments)
+internal void generate_philox(u32 result[4], u64 seed, u64 index)
 {
-	ASSERT(!arguments->next_node);
-	return { cosf(arguments->value) };
+	u32 key    [2] = { static_cast<u32>(seed ), static_cast<u32>(seed  >> 32) };
+	u32 counter[4] = { static_cast<u32>(index), static_cast<u32>(index >> 32), 0, 0 };
+
+	FOR_RANGE(round, 10)
+	{
+		u64 product_0 = static_cast<u64>(0xD2511F53) * counter[0];
+		u64 product_1 = static_cast<u64>(0xCD9E8D57) * counter[2];
+
+		u32 next[4] =
+			{
+				static_cast<u32>(product_1 >> 32) ^ counter[1] ^ key[0],
+				static_cast<u32>(product_1),
+				static_cast<u32>(product_0 >> 32) ^ counter[3] ^ key[1],
+				static_cast<u32>(product_0),
+			};
+		memcpy(counter, next, sizeof(counter));
+
+		key[0] += 0x9E3779B9;
+		key[1] += 0xBB67AE85;
+	}
+
+	memcpy(result, counter, sizeof(counter));
 }
 
-internal Value function_tan(FunctionArgumentNode* arguments)
+// @NOTE@ Uniform in [0, 1), with as many random bits as the scalar's mantissa holds so that rounding never reaches one.
+template <typename SCALAR> internal SCALAR get_random_uniform(u32 high, u32 low)
 {
-	ASSERT(!arguments->next_node);
-	return { tanf(arguments->value) };
+	if constexpr (sizeof(SCALAR) == sizeof(f32))
+	{
+		return static_cast<SCALAR>(static_cast<f32>(high >> 8) * 0x1.0p-24f);
+	}
+	else
+	{
+		return static_cast<SCALAR>(static_cast<f64>((static_cast<u64>(high) << 21) ^ (low >> 11)) * 0x1.0p-53);
+	}
 }
 
-internal Value function_atan2(FunctionArgumentNode* arguments)
+PREDEFINED_PURE PREDEFINED_VECTORIZABLE PREDEFINED_PIECEWISE_CONSTANT
+template <typename SCALAR> internal SCALAR function_rand(SCALAR seed, SCALAR index)
 {
-	ASSERT(!arguments->next_node->next_node);
-	return { atan2f(arguments->value, arguments->next_node->value) };
+	u32 bits[4];
+	generate_philox(bits, get_random_word(static_cast<f64>(seed)), get_random_word(static_cast<f64>(index)));
+	return get_random_uniform<SCALAR>(bits[0], bits[1]);
+}
+
+// @NOTE@ Standard normal, by the Box-Muller transform of two uniforms from the same draw.
+PREDEFINED_PURE PREDEFINED_VECTORIZABLE PREDEFINED_PIECEWISE_CONSTANT
+template <typename SCALAR> internal SCALAR function_randn(SCALAR seed, SCALAR index)
+{
+	u32 bits[4];
+	generate_philox(bits, get_random_word(static_cast<f64>(seed)), get_random_word(static_cast<f64>(index)));
+
+	f64 radius = sqrt(-2.0 * log(1.0 - get_random_uniform<f64>(bits[0], bits[1])));
+	f64 angle  = 6.28318530717958647692 * get_random_uniform<f64>(bits[2], bits[3]);
+	return static_cast<SCALAR>(radius * cos(angle));
 }
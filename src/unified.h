@@ -52,7 +52,7 @@ typedef double      f64;
 #define FOR_INDICIES_(NAME, MAXI)           FOR_INTERVAL_(NAME, 0, (MAXI))
 #define FOR_REPEAT_(MAXI)                   FOR_INTERVAL_(MACRO_CONCAT_(FOR_REPEAT_, __LINE__), 0, (MAXI))
 #define FOR_RANGE(...)                      MACRO_EXPAND_(MACRO_OVERLOADED_3_(__VA_ARGS__, FOR_INTERVAL_, FOR_INDICIES_, FOR_REPEAT_)(__VA_ARGS__))
-#define FOR_INTERVAL_REV_(NAME, MINI, MAXI) for (i32 NAME = (MAXI) - 1, MACRO_CONCAT_(NAME, min); NAME >= MACRO_CONCAT_(NAME, min); NAME -= 1)
+#define FOR_INTERVAL_REV_(NAME, MINI, MAXI) for (i32 NAME = (MAXI) - 1, MACRO_CONCAT_(NAME, min) = (MINI); NAME >= MACRO_CONCAT_(NAME, min); NAME -= 1)
 #define FOR_INDICIES_REV_(NAME, MAXI)       FOR_INTERVAL_REV_(NAME, 0, (MAXI))
 #define FOR_RANGE_REV(...)                  MACRO_EXPAND_(MACRO_OVERLOADED_3_(__VA_ARGS__, FOR_INTERVAL_REV_, FOR_INDICIES_REV_)(__VA_ARGS__))
 
@@ -85,7 +85,21 @@ typedef double      f64;
 	#undef min
 	#undef max
 
-	#define ASSERT(EXPRESSION) do { if (!(EXPRESSION)) { *((i32*)(0)) = 0; } } while (false)
+	// @NOTE@ Called once before a failed assertion crashes, such as to write out output that is still buffered.
+	global void (*DEBUG_assert_callback)(void) = 0;
+
+	internal void DEBUG_assert_failed(void)
+	{
+		void (*callback)(void) = DEBUG_assert_callback;
+		DEBUG_assert_callback = 0;
+		if (callback)
+		{
+			callback();
+		}
+		*((i32*)(0)) = 0;
+	}
+
+	#define ASSERT(EXPRESSION) do { if (!(EXPRESSION)) { DEBUG_assert_failed(); } } while (false)
 
 	#define DEBUG_printf(FSTR, ...)\
 	do\
@@ -727,14 +741,25 @@ internal void string_builder_append(StringBuilder* builder, const StringView& st
 	}
 }
 
-// @TODO@ Smarter implementation...
+// @NOTE@ Formats into a stack buffer; what doesn't fit is measured by that first call and formatted again into a buffer of its size.
 template <typename... ARGUMENTS>
 internal void string_builder_append(StringBuilder* builder, strlit format, ARGUMENTS... arguments)
 {
 	char buffer[1024];
-	i32  count = sprintf_s(buffer, format, arguments...);
-	ASSERT(count < ARRAY_CAPACITY(buffer));
-	string_builder_append(builder, { count, buffer });
+	i32  count = snprintf(buffer, sizeof(buffer), format, arguments...);
+	ASSERT(count >= 0); // Invalid format.
+
+	if (count < ARRAY_CAPACITY(buffer))
+	{
+		string_builder_append(builder, { count, buffer });
+	}
+	else
+	{
+		char* long_buffer = reinterpret_cast<char*>(malloc(count + 1));
+		snprintf(long_buffer, count + 1, format, arguments...);
+		string_builder_append(builder, { count, long_buffer });
+		free(long_buffer);
+	}
 }
 
 template <typename... ARGUMENTS>
@@ -763,3 +788,1398 @@ internal constexpr bool32 starts_with(const StringView& prefix, const StringView
 	return string.size >= prefix.size && StringView { prefix.size, string.data } == prefix;
 }
 
+
+//
+// Hashing.
+//
+
+// @NOTE@ FNV-1a. Not for adversarial input.
+internal u64 hash_bytes(const void* data, memsize size, u64 hash = 0xCBF29CE484222325)
+{
+	for (memsize i = 0; i < size; i += 1)
+	{
+		hash ^= static_cast<u64>(reinterpret_cast<const byte*>(data)[i]);
+		hash *= 0x100000001B3;
+	}
+	return hash;
+}
+
+internal u64 hash_bytes(const StringView& string, u64 hash = 0xCBF29CE484222325)
+{
+	return hash_bytes(string.data, string.size, hash);
+}
+
+// @NOTE@ The finalizer of SplitMix64; cheap and well-distributed for combining already hashed values.
+internal constexpr u64 hash_mix(u64 a, u64 b)
+{
+	u64 x = a ^ (b + 0x9E3779B97F4A7C15 + (a << 6) + (a >> 2));
+	x ^= x >> 30;
+	x *= 0xBF58476D1CE4E5B9;
+	x ^= x >> 27;
+	x *= 0x94D049BB133111EB;
+	x ^= x >> 31;
+	return x;
+}
+
+//
+// Perfect hashing.
+//
+
+// @NOTE@ Minimal perfect hash by hash-and-displace. A Fibonacci hash of the key's hash picks its bucket, and the bucket's displacement is
+// mixed into the hash to pick the slot. A lookup costs one hash of the key, one probe and one compare. Aim for about four keys per bucket.
+
+internal constexpr i32 get_perfect_hash_bucket_count(i32 key_count)
+{
+	return max((key_count + 3) / 4, 1);
+}
+
+internal constexpr i32 get_perfect_hash_bucket(i32 bucket_count, u64 hash)
+{
+	return static_cast<i32>(((hash * 0x9E3779B97F4A7C15) >> 32) % static_cast<u64>(bucket_count));
+}
+
+internal constexpr i32 get_perfect_hash_slot(const u32* displacement_buffer, i32 bucket_count, i32 slot_count, u64 hash)
+{
+	return static_cast<i32>(hash_mix(hash, displacement_buffer[get_perfect_hash_bucket(bucket_count, hash)]) % static_cast<u64>(slot_count));
+}
+
+// @NOTE@ Fills `displacement_buffer` and writes the slot of each key into `slot_buffer`. Buckets are placed largest first, each taking the
+// first displacement that moves all of its keys into free slots. Returns true on failure, as when two keys have the same hash.
+internal bool32 init_perfect_hash(u32* displacement_buffer, i32 bucket_count, i32* slot_buffer, const u64* hash_buffer, i32 key_count, MemoryArena* arena)
+{
+	memory_arena_checkpoint(arena);
+
+	i32*   bucket_start_buffer = memory_arena_allocate_zero<i32  >(arena, bucket_count + 1);
+	i32*   bucket_order_buffer = memory_arena_allocate     <i32  >(arena, bucket_count);
+	i32*   bucket_key_buffer   = memory_arena_allocate     <i32  >(arena, key_count);
+	bool8* is_slot_taken       = memory_arena_allocate_zero<bool8>(arena, key_count);
+
+	FOR_RANGE(i, key_count)
+	{
+		bucket_start_buffer[get_perfect_hash_bucket(bucket_count, hash_buffer[i]) + 1] += 1;
+	}
+	FOR_RANGE(i, bucket_count)
+	{
+		bucket_start_buffer[i + 1] += bucket_start_buffer[i];
+		bucket_order_buffer[i]      = i;
+	}
+	FOR_RANGE(i, key_count)
+	{
+		aliasing start = bucket_start_buffer[get_perfect_hash_bucket(bucket_count, hash_buffer[i])];
+		bucket_key_buffer[start]  = i;
+		start                    += 1;
+	}
+	for (i32 i = bucket_count - 1; i >= 0; i -= 1) // @NOTE@ Undoes the shift from filling the buckets.
+	{
+		bucket_start_buffer[i + 1] = bucket_start_buffer[i];
+	}
+	bucket_start_buffer[0] = 0;
+
+	lambda get_bucket_size = [&](i32 bucket) { return bucket_start_buffer[bucket + 1] - bucket_start_buffer[bucket]; };
+	std::sort(bucket_order_buffer, bucket_order_buffer + bucket_count, [&](i32 a, i32 b) { return get_bucket_size(a) > get_bucket_size(b); });
+
+	FOR_ELEMS(bucket, bucket_order_buffer, bucket_count)
+	{
+		i32* keys     = bucket_key_buffer + bucket_start_buffer[*bucket];
+		i32  key_size = get_bucket_size(*bucket);
+
+		displacement_buffer[*bucket] = 0;
+		while (key_size)
+		{
+			i32 placed_count = 0;
+			while (placed_count < key_size)
+			{
+				i32 slot = get_perfect_hash_slot(displacement_buffer, bucket_count, key_count, hash_buffer[keys[placed_count]]);
+				if (is_slot_taken[slot])
+				{
+					break;
+				}
+				is_slot_taken[slot]              = true;
+				slot_buffer[keys[placed_count]]  = slot;
+				placed_count                    += 1;
+			}
+
+			if (placed_count == key_size)
+			{
+				break;
+			}
+
+			FOR_ELEMS(key, keys, placed_count)
+			{
+				is_slot_taken[slot_buffer[*key]] = false;
+			}
+
+			displacement_buffer[*bucket] += 1;
+			if (displacement_buffer[*bucket] == (1U << 24))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+//
+// Float formatting.
+//
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// @NOTE@ Shortest round-trip formatting of `f32` after Ulf Adams' "Ryu: fast float-to-string conversion" (PLDI 2018). The float and
+// the halfway points to its neighbours are scaled by a power of ten using the 64-bit multipliers below, then decimal digits are dropped
+// for as long as the result stays strictly between the halfway points. Reading the output back with `strtof` gives the same float.
+
+global constexpr i32 FLOAT_POW5_INV_BITCOUNT = 59;
+global constexpr i32 FLOAT_POW5_BITCOUNT     = 61;
+
+// @NOTE@ `FLOAT_POW5_INV_SPLIT[i] = floor(2^(pow5_bits(i) - 1 + 59) / 5^i) + 1` and `FLOAT_POW5_SPLIT[i] = 5^i` normalized to 61 bits.
+global constexpr u64 FLOAT_POW5_INV_SPLIT[] =
+	{
+		0x0800000000000001, 0x0666666666666667, 0x051EB851EB851EB9, 0x04189374BC6A7EFA,
+		0x068DB8BAC710CB2A, 0x053E2D6238DA3C22, 0x0431BDE82D7B634E, 0x06B5FCA6AF2BD216,
+		0x055E63B88C230E78, 0x044B82FA09B5A52D, 0x06DF37F675EF6EAE, 0x057F5FF85E592558,
+		0x0465E6604B7A8447, 0x0709709A125DA071, 0x05A126E1A84AE6C1, 0x0480EBE7B9D58567,
+		0x0734ACA5F6226F0B, 0x05C3BD5191B525A3, 0x049C97747490EAE9, 0x0760F253EDB4AB0E,
+		0x05E72843249088D8, 0x04B8ED0283A6D3E0, 0x078E480405D7B966, 0x060B6CD004AC9452,
+		0x04D5F0A66A23A9DB, 0x07BCB43D769F762B, 0x063090312BB2C4EF, 0x04F3A68DBC8F03F3,
+		0x07EC3DAF94180651, 0x065697BFA9ACD1DA, 0x051212FFBAF0A7E2
+	};
+
+global constexpr u64 FLOAT_POW5_SPLIT[] =
+	{
+		0x1000000000000000, 0x1400000000000000, 0x1900000000000000, 0x1F40000000000000,
+		0x1388000000000000, 0x186A000000000000, 0x1E84800000000000, 0x1312D00000000000,
+		0x17D7840000000000, 0x1DCD650000000000, 0x12A05F2000000000, 0x174876E800000000,
+		0x1D1A94A200000000, 0x12309CE540000000, 0x16BCC41E90000000, 0x1C6BF52634000000,
+		0x11C37937E0800000, 0x16345785D8A00000, 0x1BC16D674EC80000, 0x1158E460913D0000,
+		0x15AF1D78B58C4000, 0x1B1AE4D6E2EF5000, 0x10F0CF064DD59200, 0x152D02C7E14AF680,
+		0x1A784379D99DB420, 0x108B2A2C28029094, 0x14ADF4B7320334B9, 0x19D971E4FE8401E7,
+		0x1027E72F1F128130, 0x1431E0FAE6D7217C, 0x193E5939A08CE9DB, 0x1F8DEF8808B02452,
+		0x13B8B5B5056E16B3, 0x18A6E32246C99C60, 0x1ED09BEAD87C0378, 0x13426172C74D822B,
+		0x1812F9CF7920E2B6, 0x1E17B84357691B64, 0x12CED32A16A1B11E, 0x178287F49C4A1D66,
+		0x1D6329F1C35CA4BF, 0x125DFA371A19E6F7, 0x16F578C4E0A060B5, 0x1CB2D6F618C878E3,
+		0x11EFC659CF7D4B8D, 0x166BB7F0435C9E71, 0x1C06A5EC5433C60D
+	};
+
+// @NOTE@ ceil(log2(5^e)) for e > 0, and 1 for e = 0.
+internal constexpr i32 pow5_bits(i32 e)
+{
+	return static_cast<i32>((static_cast<u32>(e) * 1217359) >> 19) + 1;
+}
+
+// @NOTE@ floor(log10(2^e)).
+internal constexpr i32 log10_pow2(i32 e)
+{
+	return static_cast<i32>((static_cast<u32>(e) * 78913) >> 18);
+}
+
+// @NOTE@ floor(log10(5^e)).
+internal constexpr i32 log10_pow5(i32 e)
+{
+	return static_cast<i32>((static_cast<u32>(e) * 732923) >> 20);
+}
+
+internal constexpr bool32 is_multiple_of_pow5(u32 value, i32 p)
+{
+	i32 count = 0;
+	while (value % 5 == 0)
+	{
+		value /= 5;
+		count += 1;
+	}
+	return count >= p;
+}
+
+internal constexpr bool32 is_multiple_of_pow2(u32 value, i32 p)
+{
+	return (value & ((1U << p) - 1)) == 0;
+}
+
+internal constexpr u32 mul_shift_32(u32 m, u64 factor, i32 shift)
+{
+	u64 low  = static_cast<u64>(m) * static_cast<u32>(factor);
+	u64 high = static_cast<u64>(m) * static_cast<u32>(factor >> 32);
+	return static_cast<u32>(((low >> 32) + high) >> (shift - 32));
+}
+
+// @NOTE@ The finite `value` equals `*digits * 10^*exponent` once read back; `*digits` has as few digits as possible.
+internal void shortest_decimal_of_f32(u32* digits, i32* exponent, f32 value)
+{
+	u32 bits;
+	memcpy(&bits, &value, sizeof(bits));
+	u32 ieee_mantissa = bits & ((1U << 23) - 1);
+	u32 ieee_exponent = (bits >> 23) & 0xFF;
+
+	i32 e2;
+	u32 m2;
+	if (ieee_exponent)
+	{
+		e2 = static_cast<i32>(ieee_exponent) - 127 - 23 - 2;
+		m2 = (1U << 23) | ieee_mantissa;
+	}
+	else
+	{
+		e2 = 1 - 127 - 23 - 2;
+		m2 = ieee_mantissa;
+	}
+
+	bool32 accepts_bounds = (m2 & 1) == 0;
+	u32    mv             = 4 * m2;
+	u32    mp             = 4 * m2 + 2;
+	u32    mm             = 4 * m2 - 1 - (ieee_mantissa != 0 || ieee_exponent <= 1);
+
+	u32    vr;
+	u32    vp;
+	u32    vm;
+	i32    e10;
+	bool32 is_vm_trailing_zeros = false;
+	bool32 is_vr_trailing_zeros = false;
+	u32    last_removed_digit   = 0;
+	if (e2 >= 0)
+	{
+		i32 q = log10_pow2(e2);
+		i32 i = -e2 + q + FLOAT_POW5_INV_BITCOUNT + pow5_bits(q) - 1;
+		e10 = q;
+		vr  = mul_shift_32(mv, FLOAT_POW5_INV_SPLIT[q], i);
+		vp  = mul_shift_32(mp, FLOAT_POW5_INV_SPLIT[q], i);
+		vm  = mul_shift_32(mm, FLOAT_POW5_INV_SPLIT[q], i);
+
+		if (q != 0 && (vp - 1) / 10 <= vm / 10)
+		{
+			// @NOTE@ At least one digit is going to be removed below; the last one decides the rounding.
+			last_removed_digit = mul_shift_32(mv, FLOAT_POW5_INV_SPLIT[q - 1], -e2 + q - 1 + FLOAT_POW5_INV_BITCOUNT + pow5_bits(q - 1) - 1) % 10;
+		}
+
+		if (q <= 9)
+		{
+			if (mv % 5 == 0)
+			{
+				is_vr_trailing_zeros = is_multiple_of_pow5(mv, q);
+			}
+			else if (accepts_bounds)
+			{
+				is_vm_trailing_zeros = is_multiple_of_pow5(mm, q);
+			}
+			else
+			{
+				vp -= is_multiple_of_pow5(mp, q);
+			}
+		}
+	}
+	else
+	{
+		i32 q = log10_pow5(-e2);
+		i32 i = -e2 - q;
+		i32 j = q - (pow5_bits(i) - FLOAT_POW5_BITCOUNT);
+		e10 = q + e2;
+		vr  = mul_shift_32(mv, FLOAT_POW5_SPLIT[i], j);
+		vp  = mul_shift_32(mp, FLOAT_POW5_SPLIT[i], j);
+		vm  = mul_shift_32(mm, FLOAT_POW5_SPLIT[i], j);
+
+		if (q != 0 && (vp - 1) / 10 <= vm / 10)
+		{
+			last_removed_digit = mul_shift_32(mv, FLOAT_POW5_SPLIT[i + 1], q - 1 - (pow5_bits(i + 1) - FLOAT_POW5_BITCOUNT)) % 10;
+		}
+
+		if (q <= 1)
+		{
+			is_vr_trailing_zeros = true;
+			if (accepts_bounds)
+			{
+				is_vm_trailing_zeros = mm == mv - 2;
+			}
+			else
+			{
+				vp -= 1;
+			}
+		}
+		else if (q < 31)
+		{
+			is_vr_trailing_zeros = is_multiple_of_pow2(mv, q - 1);
+		}
+	}
+
+	i32 removed_count = 0;
+	if (is_vm_trailing_zeros || is_vr_trailing_zeros)
+	{
+		// @NOTE@ Rare path where a bound or the value itself is exactly representable with fewer digits.
+		while (vp / 10 > vm / 10)
+		{
+			is_vm_trailing_zeros &= vm % 10 == 0;
+			is_vr_trailing_zeros &= last_removed_digit == 0;
+			last_removed_digit    = vr % 10;
+			vr                   /= 10;
+			vp                   /= 10;
+			vm                   /= 10;
+			removed_count        += 1;
+		}
+
+		if (is_vm_trailing_zeros)
+		{
+			while (vm % 10 == 0)
+			{
+				is_vr_trailing_zeros &= last_removed_digit == 0;
+				last_removed_digit    = vr % 10;
+				vr                   /= 10;
+				vp                   /= 10;
+				vm                   /= 10;
+				removed_count        += 1;
+			}
+		}
+
+		if (is_vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+		{
+			last_removed_digit = 4; // @NOTE@ Exactly halfway; round to even.
+		}
+
+		*digits = vr + ((vr == vm && (!accepts_bounds || !is_vm_trailing_zeros)) || last_removed_digit >= 5);
+	}
+	else
+	{
+		while (vp / 10 > vm / 10)
+		{
+			last_removed_digit  = vr % 10;
+			vr                 /= 10;
+			vp                 /= 10;
+			vm                 /= 10;
+			removed_count      += 1;
+		}
+
+		*digits = vr + (vr == vm || last_removed_digit >= 5);
+	}
+
+	*exponent = e10 + removed_count;
+}
+
+// @NOTE@ Lays out `digits * 10^exponent` after the `count` characters already in `buffer` and returns the new count; see `format_f32`.
+internal i32 format_decimal(char* buffer, i32 count, u64 digits, i32 exponent)
+{
+	char digit_buffer[20];
+	i32  digit_count = 0;
+	for (u64 remaining = digits; remaining; remaining /= 10)
+	{
+		digit_buffer[ARRAY_CAPACITY(digit_buffer) - 1 - digit_count]  = static_cast<char>('0' + remaining % 10);
+		digit_count                                                  += 1;
+	}
+	const char* digit_data = digit_buffer + ARRAY_CAPACITY(digit_buffer) - digit_count;
+
+	i32 point = digit_count + exponent; // @NOTE@ Count of digits before the decimal point.
+	if (IN_RANGE(point - 1, -5, 21))
+	{
+		if (point <= 0)
+		{
+			buffer[count]      = '0';
+			buffer[count + 1]  = '.';
+			count             += 2;
+			FOR_RANGE(-point)
+			{
+				buffer[count]  = '0';
+				count         += 1;
+			}
+			memcpy(buffer + count, digit_data, digit_count);
+			count += digit_count;
+		}
+		else if (point < digit_count)
+		{
+			memcpy(buffer + count, digit_data, point);
+			count         += point;
+			buffer[count]  = '.';
+			count         += 1;
+			memcpy(buffer + count, digit_data + point, digit_count - point);
+			count += digit_count - point;
+		}
+		else
+		{
+			memcpy(buffer + count, digit_data, digit_count);
+			count += digit_count;
+			FOR_RANGE(point - digit_count)
+			{
+				buffer[count]  = '0';
+				count         += 1;
+			}
+		}
+	}
+	else
+	{
+		buffer[count]  = digit_data[0];
+		count         += 1;
+		if (digit_count > 1)
+		{
+			buffer[count]  = '.';
+			count         += 1;
+			memcpy(buffer + count, digit_data + 1, digit_count - 1);
+			count += digit_count - 1;
+		}
+
+		i32 scientific_exponent = point - 1;
+		buffer[count]  = 'e';
+		count         += 1;
+		if (scientific_exponent < 0)
+		{
+			buffer[count]        = '-';
+			count               += 1;
+			scientific_exponent  = -scientific_exponent;
+		}
+		if (scientific_exponent >= 100)
+		{
+			buffer[count]  = static_cast<char>('0' + scientific_exponent / 100);
+			count         += 1;
+		}
+		if (scientific_exponent >= 10)
+		{
+			buffer[count]  = static_cast<char>('0' + scientific_exponent / 10 % 10);
+			count         += 1;
+		}
+		buffer[count]  = static_cast<char>('0' + scientific_exponent % 10);
+		count         += 1;
+	}
+
+	return count;
+}
+
+// @NOTE@ Writes at most 32 characters without a null terminator and returns the count. Plain notation is used while the decimal
+// exponent is within [-5, 20], as in "0.00001" and "100000000000000000000"; scientific notation like "1.5e-7" is used otherwise.
+internal i32 format_f32(char* buffer, f32 value)
+{
+	i32 count = 0;
+
+	if (signbit(value))
+	{
+		buffer[count]  = '-';
+		count         += 1;
+		value          = -value;
+	}
+
+	if (isnan(value))
+	{
+		memcpy(buffer + count, "nan", 3);
+		return count + 3;
+	}
+	else if (isinf(value))
+	{
+		memcpy(buffer + count, "inf", 3);
+		return count + 3;
+	}
+	else if (value == 0.0f)
+	{
+		buffer[count] = '0';
+		return count + 1;
+	}
+
+	u32 digits;
+	i32 exponent;
+	shortest_decimal_of_f32(&digits, &exponent, value);
+	return format_decimal(buffer, count, digits, exponent);
+}
+
+// @NOTE@ The finite `value` equals `*digits * 10^*exponent` once read back; `*digits` has as few digits as possible. Unlike the `f32`
+// version this goes through the C runtime, starting at 15 digits: any decimal of at most 15 digits that reads back as a normal `value`
+// is within half a unit of the 15th digit, so it is what 15 digits round to, trailing zeros aside. Only values needing 16 or 17 digits
+// take more than one try. Subnormals have fewer bits, so they are tried from a single digit up.
+internal void shortest_decimal_of_f64(u64* digits, i32* exponent, f64 value)
+{
+	char buffer[32];
+	for (i32 precision = fabs(value) < 0x1p-1022 ? 1 : 15; precision <= 17; precision += 1)
+	{
+		snprintf(buffer, sizeof(buffer), "%.*e", precision - 1, value);
+		if (strtod(buffer, 0) == value || precision == 17)
+		{
+			break;
+		}
+	}
+
+	*digits = 0;
+	i32 digit_count = 0;
+	char* at = buffer;
+	for (; *at != 'e'; at += 1)
+	{
+		if (IN_RANGE(*at, '0', '9' + 1))
+		{
+			*digits      = *digits * 10 + static_cast<u64>(*at - '0');
+			digit_count += 1;
+		}
+	}
+	*exponent = atoi(at + 1) - (digit_count - 1);
+
+	while (*digits % 10 == 0)
+	{
+		*digits   /= 10;
+		*exponent += 1;
+	}
+}
+
+// @NOTE@ Writes at most 32 characters without a null terminator and returns the count, laid out like `format_f32`.
+internal i32 format_f64(char* buffer, f64 value)
+{
+	i32 count = 0;
+
+	if (signbit(value))
+	{
+		buffer[count]  = '-';
+		count         += 1;
+		value          = -value;
+	}
+
+	if (isnan(value))
+	{
+		memcpy(buffer + count, "nan", 3);
+		return count + 3;
+	}
+	else if (isinf(value))
+	{
+		memcpy(buffer + count, "inf", 3);
+		return count + 3;
+	}
+	else if (value == 0.0)
+	{
+		buffer[count] = '0';
+		return count + 1;
+	}
+
+	u64 digits;
+	i32 exponent;
+	shortest_decimal_of_f64(&digits, &exponent, value);
+	return format_decimal(buffer, count, digits, exponent);
+}
+
+//
+// Big integers.
+//
+
+// @NOTE@ Magnitudes of any size as arrays of 32-bit limbs, least significant first, so that the product of two limbs plus two more fits
+// in a `u64`. Every array comes with its count of limbs, which may include leading zeros unless said otherwise. Scratch memory is taken
+// from the given arena and given back before returning.
+
+global constexpr i32 KARATSUBA_THRESHOLD    = 32; // @NOTE@ Limbs of the shorter operand below which schoolbook multiplication is faster.
+global constexpr i32 DECIMAL_SPLIT_MIN_SIZE = 48; // @NOTE@ Limbs below which decimal digits are peeled off one limb's worth at a time.
+global constexpr u32 DECIMAL_LIMB           = 1000000000; // @NOTE@ 10^9, the largest power of ten that fits in a limb.
+global constexpr i32 DECIMAL_LIMB_DIGITS    = 9;
+
+internal constexpr i32 count_leading_zeros(u32 x)
+{
+	if (!x)
+	{
+		return 32;
+	}
+
+	i32 count = 0;
+	while (!(x & 0x80000000))
+	{
+		x     <<= 1;
+		count  += 1;
+	}
+	return count;
+}
+
+// @NOTE@ The count without leading zero limbs.
+internal i32 trim_limbs(const u32* limbs, i32 count)
+{
+	while (count && !limbs[count - 1])
+	{
+		count -= 1;
+	}
+	return count;
+}
+
+// @NOTE@ Negative, zero or positive as `a` is less than, equal to or greater than `b`.
+internal i32 compare_limbs(const u32* a, i32 a_count, const u32* b, i32 b_count)
+{
+	a_count = trim_limbs(a, a_count);
+	b_count = trim_limbs(b, b_count);
+	if (a_count != b_count)
+	{
+		return a_count < b_count ? -1 : 1;
+	}
+
+	FOR_RANGE_REV(i, a_count)
+	{
+		if (a[i] != b[i])
+		{
+			return a[i] < b[i] ? -1 : 1;
+		}
+	}
+	return 0;
+}
+
+// @NOTE@ Writes the `a_count` low limbs of `a + b` and returns the carry out of them. Needs `a_count >= b_count`; `result` may be `a`.
+internal u32 add_limbs(u32* result, const u32* a, i32 a_count, const u32* b, i32 b_count)
+{
+	ASSERT(a_count >= b_count);
+
+	u64 carry = 0;
+	FOR_RANGE(i, b_count)
+	{
+		carry     += static_cast<u64>(a[i]) + b[i];
+		result[i]  = static_cast<u32>(carry);
+		carry    >>= 32;
+	}
+	FOR_RANGE(i, b_count, a_count)
+	{
+		carry     += a[i];
+		result[i]  = static_cast<u32>(carry);
+		carry    >>= 32;
+	}
+	return static_cast<u32>(carry);
+}
+
+// @NOTE@ Writes the `a_count` low limbs of `a - b` and returns the borrow out of them. Needs `a_count >= b_count`; `result` may be `a`.
+internal u32 subtract_limbs(u32* result, const u32* a, i32 a_count, const u32* b, i32 b_count)
+{
+	ASSERT(a_count >= b_count);
+
+	u64 borrow = 0;
+	FOR_RANGE(i, b_count)
+	{
+		u64 difference = static_cast<u64>(a[i]) - b[i] - borrow;
+		result[i] = static_cast<u32>(difference);
+		borrow    = difference >> 63;
+	}
+	FOR_RANGE(i, b_count, a_count)
+	{
+		u64 difference = static_cast<u64>(a[i]) - borrow;
+		result[i] = static_cast<u32>(difference);
+		borrow    = difference >> 63;
+	}
+	return static_cast<u32>(borrow);
+}
+
+// @NOTE@ Adds `b` into `a` in place, carrying only as far as needed. The sum must fit in `a_count` limbs.
+internal void accumulate_limbs(u32* a, i32 a_count, const u32* b, i32 b_count)
+{
+	ASSERT(a_count >= b_count);
+
+	u64 carry = 0;
+	FOR_RANGE(i, b_count)
+	{
+		carry   += static_cast<u64>(a[i]) + b[i];
+		a[i]     = static_cast<u32>(carry);
+		carry  >>= 32;
+	}
+	for (i32 i = b_count; carry; i += 1)
+	{
+		ASSERT(i < a_count); // Sum doesn't fit.
+		carry   += a[i];
+		a[i]     = static_cast<u32>(carry);
+		carry  >>= 32;
+	}
+}
+
+// @NOTE@ Writes the `a_count` low limbs of `a * b + carry` and returns the limb above them; `result` may be `a`.
+internal u32 multiply_limbs_by_limb(u32* result, const u32* a, i32 a_count, u32 b, u32 carry)
+{
+	u64 product = carry;
+	FOR_RANGE(i, a_count)
+	{
+		product    += static_cast<u64>(a[i]) * b;
+		result[i]   = static_cast<u32>(product);
+		product   >>= 32;
+	}
+	return static_cast<u32>(product);
+}
+
+// @NOTE@ Writes the `a_count` limbs of `a / b` and returns the remainder; `quotient` may be `a`.
+internal u32 divide_limbs_by_limb(u32* quotient, const u32* a, i32 a_count, u32 b)
+{
+	ASSERT(b);
+
+	u64 remainder = 0;
+	FOR_RANGE_REV(i, a_count)
+	{
+		u64 dividend = (remainder << 32) | a[i];
+		quotient[i] = static_cast<u32>(dividend / b);
+		remainder   = dividend % b;
+	}
+	return static_cast<u32>(remainder);
+}
+
+// @NOTE@ Writes all `a_count + b_count` limbs of `a * b`, which must not overlap either operand.
+internal void multiply_limbs_schoolbook(u32* result, const u32* a, i32 a_count, const u32* b, i32 b_count)
+{
+	memset(result, 0, sizeof(u32) * (a_count + b_count));
+	FOR_RANGE(j, b_count)
+	{
+		u64 product = 0;
+		FOR_RANGE(i, a_count)
+		{
+			product           += static_cast<u64>(a[i]) * b[j] + result[i + j];
+			result[i + j]      = static_cast<u32>(product);
+			product          >>= 32;
+		}
+		result[a_count + j] = static_cast<u32>(product);
+	}
+}
+
+// @NOTE@ Writes all `a_count + b_count` limbs of `a * b`, which must not overlap either operand. With both operands at least
+// `KARATSUBA_THRESHOLD` limbs long, they are split as `a1 * B^m + a0` and `b1 * B^m + b0`, and the product is put together from three
+// half-size products instead of four: `a0 * b0`, `a1 * b1`, and `(a0 + a1) * (b0 + b1)` less the other two for the middle term. That
+// takes time in the 1.58th power of the length rather than the square. An operand less than half as long as the other is instead
+// multiplied against it a slice of its own length at a time, so that the halves stay balanced.
+internal void multiply_limbs(u32* result, const u32* a, i32 a_count, const u32* b, i32 b_count, MemoryArena* scratch)
+{
+	if (a_count < b_count)
+	{
+		multiply_limbs(result, b, b_count, a, a_count, scratch);
+		return;
+	}
+
+	if (b_count < KARATSUBA_THRESHOLD)
+	{
+		multiply_limbs_schoolbook(result, a, a_count, b, b_count);
+		return;
+	}
+
+	memory_arena_checkpoint(scratch);
+
+	if (a_count >= 2 * b_count)
+	{
+		u32* product = memory_arena_allocate<u32>(scratch, 2 * b_count);
+		memset(result, 0, sizeof(u32) * (a_count + b_count));
+		for (i32 start = 0; start < a_count; start += b_count)
+		{
+			i32 slice_count = min(b_count, a_count - start);
+			multiply_limbs(product, a + start, slice_count, b, b_count, scratch);
+			accumulate_limbs(result + start, a_count + b_count - start, product, slice_count + b_count);
+		}
+		return;
+	}
+
+	i32        m        = a_count / 2;
+	const u32* a0       = a;
+	const u32* a1       = a + m;
+	i32        a1_count = a_count - m;
+	const u32* b0       = b;
+	const u32* b1       = b + m;
+	i32        b1_count = b_count - m;
+
+	multiply_limbs(result        , a0, m       , b0, m       , scratch);
+	multiply_limbs(result + 2 * m, a1, a1_count, b1, b1_count, scratch);
+
+	i32  a_sum_count = a1_count + 1;
+	i32  b_sum_count = max(m, b1_count) + 1;
+	u32* a_sum       = memory_arena_allocate<u32>(scratch, a_sum_count);
+	u32* b_sum       = memory_arena_allocate<u32>(scratch, b_sum_count);
+	a_sum[a1_count]  = add_limbs(a_sum, a1, a1_count, a0, m);
+	b_sum[b_sum_count - 1] =
+		b1_count >= m
+			? add_limbs(b_sum, b1, b1_count, b0, m)
+			: add_limbs(b_sum, b0, m, b1, b1_count);
+
+	i32  middle_count = a_sum_count + b_sum_count;
+	u32* middle       = memory_arena_allocate<u32>(scratch, middle_count);
+	multiply_limbs(middle, a_sum, a_sum_count, b_sum, b_sum_count, scratch);
+	subtract_limbs(middle, middle, middle_count, result        , 2 * m);
+	subtract_limbs(middle, middle, middle_count, result + 2 * m, a1_count + b1_count);
+
+	accumulate_limbs(result + m, a_count + b_count - m, middle, trim_limbs(middle, middle_count));
+}
+
+// @NOTE@ Writes the `count` limbs of `a` shifted left by `shift` bits, which is less than 32, and returns the bits shifted out.
+internal u32 shift_limbs_left(u32* result, const u32* a, i32 count, i32 shift)
+{
+	if (!shift)
+	{
+		memmove(result, a, sizeof(u32) * count);
+		return 0;
+	}
+
+	u32 carry = 0;
+	FOR_RANGE(i, count)
+	{
+		u32 limb = a[i];
+		result[i] = (limb << shift) | carry;
+		carry     = limb >> (32 - shift);
+	}
+	return carry;
+}
+
+// @NOTE@ Knuth's algorithm D (The Art of Computer Programming, 4.3.1). Writes the `a_count - b_count + 1` limbs of the quotient and the
+// `b_count` limbs of the remainder; either may be null when it isn't wanted. `b` must have no leading zero limbs and no more limbs than
+// `a`. Both are shifted until the top bit of `b` is set, so that each estimate of a quotient limb from the top two limbs of what is left
+// is at most two too high.
+internal void divide_limbs(u32* quotient, u32* remainder, const u32* a, i32 a_count, const u32* b, i32 b_count, MemoryArena* scratch)
+{
+	ASSERT(b_count && b[b_count - 1]);
+	ASSERT(a_count >= b_count);
+
+	memory_arena_checkpoint(scratch);
+
+	if (!quotient)
+	{
+		quotient = memory_arena_allocate<u32>(scratch, a_count - b_count + 1);
+	}
+
+	if (b_count == 1)
+	{
+		u32 rest = divide_limbs_by_limb(quotient, a, a_count, b[0]);
+		if (remainder)
+		{
+			remainder[0] = rest;
+		}
+		return;
+	}
+
+	i32  shift = count_leading_zeros(b[b_count - 1]);
+	u32* u     = memory_arena_allocate<u32>(scratch, a_count + 1);
+	u32* v     = memory_arena_allocate<u32>(scratch, b_count);
+	shift_limbs_left(v, b, b_count, shift);
+	u[a_count] = shift_limbs_left(u, a, a_count, shift);
+
+	i32 n = b_count;
+	FOR_RANGE_REV(j, a_count - b_count + 1)
+	{
+		u64 dividend = (static_cast<u64>(u[j + n]) << 32) | u[j + n - 1];
+		u64 estimate = dividend / v[n - 1];
+		u64 rest     = dividend % v[n - 1];
+		while (estimate >> 32 || estimate * v[n - 2] > ((rest << 32) | u[j + n - 2]))
+		{
+			estimate -= 1;
+			rest     += v[n - 1];
+			if (rest >> 32)
+			{
+				break;
+			}
+		}
+
+		i64 borrow = 0;
+		FOR_RANGE(i, n)
+		{
+			u64 product    = estimate * v[i];
+			i64 difference = static_cast<i64>(u[i + j]) - borrow - static_cast<i64>(product & 0xFFFFFFFF);
+			u[i + j] = static_cast<u32>(difference);
+			borrow   = static_cast<i64>(product >> 32) - (difference >> 32);
+		}
+		i64 difference = static_cast<i64>(u[j + n]) - borrow;
+		u[j + n] = static_cast<u32>(difference);
+
+		if (difference < 0) // @NOTE@ The estimate was one too high, which is rare; add one divisor back.
+		{
+			estimate -= 1;
+			u[j + n] += add_limbs(u + j, u + j, n, v, n);
+		}
+
+		quotient[j] = static_cast<u32>(estimate);
+	}
+
+	if (remainder)
+	{
+		if (shift)
+		{
+			FOR_RANGE(i, n)
+			{
+				remainder[i] = (u[i] >> shift) | (i + 1 < n ? u[i + 1] << (32 - shift) : 0);
+			}
+		}
+		else
+		{
+			memcpy(remainder, u, sizeof(u32) * n);
+		}
+	}
+}
+
+// @NOTE@ Writes the limbs of a string of decimal digits and returns their count, without leading zero limbs. `result` must hold
+// `digits.size / 9 + 1` limbs.
+internal i32 parse_limbs(u32* result, StringView digits)
+{
+	i32 count = 0;
+	i32 index = 0;
+	while (index < digits.size)
+	{
+		i32 chunk_size = (digits.size - index) % DECIMAL_LIMB_DIGITS ? (digits.size - index) % DECIMAL_LIMB_DIGITS : DECIMAL_LIMB_DIGITS;
+		u32 chunk      = 0;
+		u32 scale      = 1;
+		FOR_RANGE(chunk_size)
+		{
+			chunk  = chunk * 10 + static_cast<u32>(digits.data[index] - '0');
+			scale *= 10;
+			index += 1;
+		}
+
+		u32 carry = multiply_limbs_by_limb(result, result, count, scale, chunk);
+		if (carry)
+		{
+			result[count]  = carry;
+			count         += 1;
+		}
+	}
+	return count;
+}
+
+// @NOTE@ Scratch that `format_limbs` needs for a magnitude of `count` limbs.
+internal constexpr memsize get_format_limbs_scratch_size(i32 count)
+{
+	return sizeof(u32) * (16 * static_cast<memsize>(count) + 64);
+}
+
+// @NOTE@ Digits of a magnitude with no leading zero limbs and at most `DECIMAL_SPLIT_MIN_SIZE` of them, found by dividing by 10^9 over
+// and over. With a nonzero `digit_count`, leading zeros pad it to that many digits.
+internal i32 format_limbs_by_limb(char* buffer, const u32* limbs, i32 count, i32 digit_count, MemoryArena* scratch)
+{
+	memory_arena_checkpoint(scratch);
+
+	u32* rest        = memory_arena_allocate<u32>(scratch, count);
+	u32* chunks      = memory_arena_allocate<u32>(scratch, count * 2 + 1); // @NOTE@ Least significant first.
+	i32  chunk_count = 0;
+	memcpy(rest, limbs, sizeof(u32) * count);
+	while (count)
+	{
+		chunks[chunk_count]  = divide_limbs_by_limb(rest, rest, count, DECIMAL_LIMB);
+		chunk_count         += 1;
+		count                = trim_limbs(rest, count);
+	}
+
+	char top_buffer[DECIMAL_LIMB_DIGITS];
+	i32  top_size = 0;
+	if (chunk_count)
+	{
+		for (u32 top = chunks[chunk_count - 1]; top; top /= 10)
+		{
+			top_buffer[DECIMAL_LIMB_DIGITS - 1 - top_size]  = static_cast<char>('0' + top % 10);
+			top_size                                       += 1;
+		}
+	}
+
+	i32 size    = chunk_count ? top_size + (chunk_count - 1) * DECIMAL_LIMB_DIGITS : 0;
+	i32 padding = digit_count ? digit_count - size : !size;
+	ASSERT(padding >= 0); // Doesn't fit in the digits.
+
+	memset(buffer, '0', padding);
+	memcpy(buffer + padding, top_buffer + DECIMAL_LIMB_DIGITS - top_size, top_size);
+
+	char* cursor = buffer + padding + top_size;
+	FOR_RANGE_REV(i, chunk_count - 1)
+	{
+		u32 chunk = chunks[i];
+		FOR_RANGE_REV(k, DECIMAL_LIMB_DIGITS)
+		{
+			cursor[k]  = static_cast<char>('0' + chunk % 10);
+			chunk     /= 10;
+		}
+		cursor += DECIMAL_LIMB_DIGITS;
+	}
+
+	return padding + size;
+}
+
+internal i32 format_limbs_by_halves(char* buffer, const u32* limbs, i32 count, i32 digit_count, u32** powers, i32* power_counts, i32 level, MemoryArena* scratch)
+{
+	count = trim_limbs(limbs, count);
+	while (level >= 0 && 2 * power_counts[level] > count)
+	{
+		level -= 1;
+	}
+
+	if (count < DECIMAL_SPLIT_MIN_SIZE || level < 0)
+	{
+		return format_limbs_by_limb(buffer, limbs, count, digit_count, scratch);
+	}
+
+	memory_arena_checkpoint(scratch);
+
+	i32  low_digit_count = DECIMAL_LIMB_DIGITS << level;
+	i32  high_count      = count - power_counts[level] + 1;
+	u32* high            = memory_arena_allocate<u32>(scratch, high_count);
+	u32* low             = memory_arena_allocate<u32>(scratch, power_counts[level]);
+	divide_limbs(high, low, limbs, count, powers[level], power_counts[level], scratch);
+
+	i32 size  = format_limbs_by_halves(buffer, high, high_count, digit_count ? digit_count - low_digit_count : 0, powers, power_counts, level - 1, scratch);
+	size     += format_limbs_by_halves(buffer + size, low, power_counts[level], low_digit_count, powers, power_counts, level - 1, scratch);
+	return size;
+}
+
+// @NOTE@ Writes the decimal digits of a magnitude without a null terminator and returns their count. `buffer` must hold `10 * count + 1`
+// characters and `scratch` must have `get_format_limbs_scratch_size(count)` bytes to spare. Peeling off nine digits at a time takes time
+// in the square of the length, so long magnitudes are divided by 10^(9 * 2^k), with `k` chosen to leave the quotient and the remainder
+// of about the same length, and both halves are written the same way, the remainder padded to its `9 * 2^k` digits. The powers of ten
+// are squared from one another with `multiply_limbs`.
+internal i32 format_limbs(char* buffer, const u32* limbs, i32 count, MemoryArena* scratch)
+{
+	count = trim_limbs(limbs, count);
+	if (count < DECIMAL_SPLIT_MIN_SIZE)
+	{
+		return format_limbs_by_limb(buffer, limbs, count, 0, scratch);
+	}
+
+	memory_arena_checkpoint(scratch);
+
+	u32* powers      [32];
+	i32  power_counts[32];
+	i32  level_count = 1;
+	powers      [0]  = memory_arena_allocate<u32>(scratch);
+	power_counts[0]  = 1;
+	*powers[0]       = DECIMAL_LIMB;
+	while (4 * power_counts[level_count - 1] <= count)
+	{
+		u32* square = memory_arena_allocate<u32>(scratch, 2 * power_counts[level_count - 1]);
+		multiply_limbs(square, powers[level_count - 1], power_counts[level_count - 1], powers[level_count - 1], power_counts[level_count - 1], scratch);
+		powers      [level_count]  = square;
+		power_counts[level_count]  = trim_limbs(square, 2 * power_counts[level_count - 1]);
+		level_count               += 1;
+	}
+
+	return format_limbs_by_halves(buffer, limbs, count, 0, powers, power_counts, level_count - 1, scratch);
+}
+
+//
+// Files.
+//
+
+#include <windows.h>
+#undef interface
+#undef min
+#undef max
+
+struct MappedFile
+{
+	memsize size;
+	byte*   data;
+	HANDLE  file;
+	HANDLE  mapping;
+};
+
+// @NOTE@ Copy-on-write mappings may be written to without affecting the file. The preferred address is only a hint.
+internal bool32 init_mapped_file(MappedFile* mapped_file, strlit file_path, bool32 is_copy_on_write = false, void* preferred_address = 0)
+{
+	mapped_file->file = CreateFileA(file_path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+	if (mapped_file->file == INVALID_HANDLE_VALUE)
+	{
+		return true;
+	}
+
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(mapped_file->file, &file_size) || file_size.QuadPart == 0)
+	{
+		CloseHandle(mapped_file->file);
+		return true;
+	}
+	mapped_file->size = static_cast<memsize>(file_size.QuadPart);
+
+	mapped_file->mapping = CreateFileMappingA(mapped_file->file, 0, is_copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, 0);
+	if (!mapped_file->mapping)
+	{
+		CloseHandle(mapped_file->file);
+		return true;
+	}
+
+	DWORD access = is_copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ;
+	mapped_file->data = reinterpret_cast<byte*>(MapViewOfFileEx(mapped_file->mapping, access, 0, 0, 0, preferred_address));
+	if (!mapped_file->data && preferred_address)
+	{
+		mapped_file->data = reinterpret_cast<byte*>(MapViewOfFileEx(mapped_file->mapping, access, 0, 0, 0, 0));
+	}
+	if (!mapped_file->data)
+	{
+		CloseHandle(mapped_file->mapping);
+		CloseHandle(mapped_file->file);
+		return true;
+	}
+
+	return false;
+}
+
+internal void deinit_mapped_file(MappedFile* mapped_file)
+{
+	UnmapViewOfFile(mapped_file->data);
+	CloseHandle(mapped_file->mapping);
+	CloseHandle(mapped_file->file);
+}
+
+internal bool32 write_entire_file(strlit file_path, const void* data, memsize size)
+{
+	FILE* file;
+	if (fopen_s(&file, file_path, "wb"))
+	{
+		return true;
+	}
+	DEFER { fclose(file); };
+
+	return fwrite(data, 1, size, file) != size;
+}
+
+//
+// Jobs.
+//
+
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+struct JobWorker;
+
+typedef void JobFunction(JobWorker* worker, void* data);
+typedef void JobRangeFunction(JobWorker* worker, i32 start, i32 end, void* data);
+
+struct JobCounter
+{
+	std::atomic<i32> value;
+};
+
+struct Job
+{
+	JobFunction* function;
+	void*        data;
+	JobCounter*  counter;
+};
+
+// @NOTE@ Chase-Lev deque with the memory orderings from "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al.).
+// The owner pushes and takes at `bottom`, thieves steal at `top`. Jobs are not owned by the deque; they must outlive their counter's wait.
+struct JobDeque
+{
+	std::atomic<i64>  top;
+	std::atomic<i64>  bottom;
+	std::atomic<Job*> buffer[256];
+};
+
+struct JobSystem;
+
+struct JobWorker
+{
+	JobSystem*  system;
+	i32         index;
+	u32         random_state;
+	MemoryArena scratch;
+	JobDeque    deque;
+	std::thread thread;
+};
+
+struct JobSystem
+{
+	std::atomic<bool32> is_running;
+	i32                 worker_count;
+	JobWorker           workers[64];
+};
+
+internal bool32 job_deque_push(JobDeque* deque, Job* job)
+{
+	i64 bottom = deque->bottom.load(std::memory_order_relaxed);
+	i64 top    = deque->top.load(std::memory_order_acquire);
+
+	if (bottom - top >= static_cast<i64>(ARRAY_CAPACITY(deque->buffer)))
+	{
+		return false;
+	}
+
+	deque->buffer[bottom & (ARRAY_CAPACITY(deque->buffer) - 1)].store(job, std::memory_order_relaxed);
+	deque->bottom.store(bottom + 1, std::memory_order_release);
+	return true;
+}
+
+internal Job* job_deque_take(JobDeque* deque)
+{
+	i64 bottom = deque->bottom.load(std::memory_order_relaxed) - 1;
+	deque->bottom.store(bottom, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	i64 top = deque->top.load(std::memory_order_relaxed);
+
+	if (top <= bottom)
+	{
+		Job* job = deque->buffer[bottom & (ARRAY_CAPACITY(deque->buffer) - 1)].load(std::memory_order_relaxed);
+		if (top == bottom)
+		{
+			if (!deque->top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				job = 0; // @NOTE@ Lost the race for the last job to a thief.
+			}
+			deque->bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+		return job;
+	}
+	else
+	{
+		deque->bottom.store(bottom + 1, std::memory_order_relaxed);
+		return 0;
+	}
+}
+
+internal Job* job_deque_steal(JobDeque* deque)
+{
+	i64 top = deque->top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	i64 bottom = deque->bottom.load(std::memory_order_acquire);
+
+	if (top < bottom)
+	{
+		Job* job = deque->buffer[top & (ARRAY_CAPACITY(deque->buffer) - 1)].load(std::memory_order_relaxed);
+		if (deque->top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			return job;
+		}
+	}
+
+	return 0;
+}
+
+internal void job_run(JobWorker* worker, Job* job)
+{
+	job->function(worker, job->data);
+	if (job->counter)
+	{
+		job->counter->value.fetch_sub(1, std::memory_order_release);
+	}
+}
+
+// @NOTE@ Runs at most one job, either from the worker's own deque or stolen from a random victim.
+internal bool32 job_help(JobWorker* worker)
+{
+	Job* job = job_deque_take(&worker->deque);
+
+	if (!job && worker->system->worker_count > 1)
+	{
+		worker->random_state ^= worker->random_state << 13;
+		worker->random_state ^= worker->random_state >> 17;
+		worker->random_state ^= worker->random_state << 5;
+
+		i32 victim_offset = static_cast<i32>(worker->random_state % static_cast<u32>(worker->system->worker_count - 1)) + 1;
+		FOR_RANGE(i, worker->system->worker_count - 1)
+		{
+			JobWorker* victim = &worker->system->workers[(worker->index + victim_offset + i) % worker->system->worker_count];
+			job = job_deque_steal(&victim->deque);
+			if (job)
+			{
+				break;
+			}
+		}
+	}
+
+	if (job)
+	{
+		job_run(worker, job);
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+// @NOTE@ The job must stay alive until a `job_wait` on its counter returns. If the deque is full, the job is simply run inline.
+internal void job_fork(JobWorker* worker, Job* job)
+{
+	if (job->counter)
+	{
+		job->counter->value.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	if (!job_deque_push(&worker->deque, job))
+	{
+		job_run(worker, job);
+	}
+}
+
+internal void job_wait(JobWorker* worker, JobCounter* counter)
+{
+	while (counter->value.load(std::memory_order_acquire) > 0)
+	{
+		if (!job_help(worker))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+struct JobParallelFor_
+{
+	JobRangeFunction* function;
+	void*             data;
+	i32               granularity;
+	i32               start;
+	i32               end;
+};
+
+// @NOTE@ Lazy binary splitting; the right halves are forked so that thieves take the largest pieces first.
+internal void JobParallelFor_execute_(JobWorker* worker, void* data)
+{
+	JobParallelFor_ range = *reinterpret_cast<JobParallelFor_*>(data);
+
+	JobCounter      counter = {};
+	JobParallelFor_ split_buffer[32];
+	Job             job_buffer[32];
+	i32             split_count = 0;
+
+	while (range.end - range.start > range.granularity)
+	{
+		i32 middle = range.start + (range.end - range.start) / 2;
+
+		split_buffer[split_count]       = range;
+		split_buffer[split_count].start = middle;
+		job_buffer  [split_count]       = { JobParallelFor_execute_, &split_buffer[split_count], &counter };
+		job_fork(worker, &job_buffer[split_count]);
+		split_count += 1;
+
+		range.end = middle;
+	}
+
+	range.function(worker, range.start, range.end, range.data);
+	job_wait(worker, &counter);
+}
+
+internal void job_parallel_for(JobWorker* worker, i32 count, i32 granularity, JobRangeFunction* function, void* data)
+{
+	JobParallelFor_ range;
+	range.function    = function;
+	range.data        = data;
+	range.granularity = max(granularity, 1);
+	range.start       = 0;
+	range.end         = count;
+	JobParallelFor_execute_(worker, &range);
+}
+
+internal void JobWorker_loop_(JobWorker* worker)
+{
+	i32 idle_count = 0;
+	while (worker->system->is_running.load(std::memory_order_acquire))
+	{
+		if (job_help(worker))
+		{
+			idle_count = 0;
+		}
+		else if (idle_count < 64)
+		{
+			idle_count += 1;
+			std::this_thread::yield();
+		}
+		else
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(50));
+		}
+	}
+}
+
+// @NOTE@ The calling thread becomes worker zero and only runs jobs while inside `job_wait`. A `worker_count` of zero means one worker per core.
+internal void init_job_system(JobSystem* system, MemoryArena* arena, i32 worker_count, memsize scratch_size_per_worker)
+{
+	if (worker_count <= 0)
+	{
+		worker_count = static_cast<i32>(std::thread::hardware_concurrency());
+	}
+
+	system->is_running.store(true, std::memory_order_relaxed);
+	system->worker_count = clamp(worker_count, 1, static_cast<i32>(ARRAY_CAPACITY(system->workers)));
+
+	FOR_ELEMS(worker, system->workers, system->worker_count)
+	{
+		worker->system       = system;
+		worker->index        = worker_index;
+		worker->random_state = (0x9E3779B9 ^ (static_cast<u32>(worker_index) * 0x85EBCA6B)) | 1;
+		worker->scratch      = memory_arena_reserve(arena, scratch_size_per_worker);
+		worker->deque.top.store(0, std::memory_order_relaxed);
+		worker->deque.bottom.store(0, std::memory_order_relaxed);
+	}
+
+	FOR_ELEMS(worker, system->workers + 1, system->worker_count - 1)
+	{
+		worker->thread = std::thread(JobWorker_loop_, worker);
+	}
+}
+
+internal void deinit_job_system(JobSystem* system)
+{
+	system->is_running.store(false, std::memory_order_release);
+
+	FOR_ELEMS(worker, system->workers + 1, system->worker_count - 1)
+	{
+		worker->thread.join();
+	}
+}